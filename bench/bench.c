@@ -0,0 +1,665 @@
+/* clock_gettime 需要 POSIX 支持 */
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include "../src/leptjson.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* 每个文档每个阶段默认处理的数据量 */
+#ifndef BENCH_TARGET_BYTES
+#define BENCH_TARGET_BYTES (64 * 1024 * 1024)
+#endif
+
+/* 每个文档每个阶段的最少迭代次数，保证 p99 有意义 */
+#ifndef BENCH_MIN_ITERATIONS
+#define BENCH_MIN_ITERATIONS 20
+#endif
+
+/*****************/
+/* 简单字符串缓冲 */
+/*****************/
+
+typedef struct {
+	char* s;
+	size_t len, cap;
+} bench_buf;
+
+static void buf_reserve(bench_buf* b, size_t n) {
+	if (b->len + n + 1 > b->cap) {
+		while (b->len + n + 1 > b->cap)
+			b->cap = b->cap == 0 ? 4096 : b->cap * 2;
+		b->s = (char*)realloc(b->s, b->cap);
+	}
+}
+
+static void buf_puts(bench_buf* b, const char* s) {
+	size_t n = strlen(s);
+	buf_reserve(b, n);
+	memcpy(b->s + b->len, s, n);
+	b->len += n;
+	b->s[b->len] = '\0';
+}
+
+static void buf_printf_num(bench_buf* b, const char* fmt, double d) {
+	buf_reserve(b, 64);
+	b->len += sprintf(b->s + b->len, fmt, d);
+}
+
+static void buf_printf_int(bench_buf* b, const char* fmt, long i) {
+	buf_reserve(b, 64);
+	b->len += sprintf(b->s + b->len, fmt, i);
+}
+
+/* 去掉末尾多余的 ',' */
+static void buf_trim_comma(bench_buf* b) {
+	if (b->len > 0 && b->s[b->len - 1] == ',')
+		b->s[--b->len] = '\0';
+}
+
+/* 线性同余随机数，保证每次生成的语料完全一致 */
+static unsigned long bench_seed;
+
+static unsigned long bench_rand(void) {
+	bench_seed = (bench_seed * 1103515245UL + 12345UL) & 0x7FFFFFFFUL;
+	return bench_seed;
+}
+
+static double bench_rand_double(double lo, double hi) {
+	return lo + (hi - lo) * (double)bench_rand() / (double)0x7FFFFFFFUL;
+}
+
+static void buf_rand_word(bench_buf* b, size_t len) {
+	static const char alpha[] = "abcdefghijklmnopqrstuvwxyz"
+	                            "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789 ";
+	size_t i;
+	buf_reserve(b, len);
+	for (i = 0; i < len; i++)
+		b->s[b->len++] = alpha[bench_rand() % (sizeof(alpha) - 1)];
+	b->s[b->len] = '\0';
+}
+
+/*************/
+/* 语料生成器 */
+/*************/
+
+/* 数值密集数组 */
+static void gen_numbers(bench_buf* b, size_t target) {
+	buf_puts(b, "[");
+	while (b->len < target) {
+		switch (bench_rand() % 3) {
+		case 0:
+			buf_printf_int(b, "%ld,", (long)(bench_rand() % 1000000));
+			break;
+		case 1:
+			buf_printf_num(b, "%.6f,", bench_rand_double(-1000.0, 1000.0));
+			break;
+		default:
+			buf_printf_num(b, "%.17g,", bench_rand_double(-1e10, 1e10));
+			break;
+		}
+	}
+	buf_trim_comma(b);
+	buf_puts(b, "]");
+}
+
+/* 字符串密集文档，以长 ASCII 字符串为主，少量转义 */
+static void gen_strings(bench_buf* b, size_t target) {
+	buf_puts(b, "[");
+	while (b->len < target) {
+		buf_puts(b, "\"");
+		buf_rand_word(b, 16 + bench_rand() % 240);
+		if (bench_rand() % 8 == 0)
+			buf_puts(b, "\\n\\t\\\"\\u00e9\\u4e2d");
+		buf_puts(b, "\",");
+	}
+	buf_trim_comma(b);
+	buf_puts(b, "]");
+}
+
+/* 深层嵌套，数组与对象交替 */
+static void gen_nested(bench_buf* b, size_t target) {
+	const size_t depth = 256;
+	size_t i;
+	buf_puts(b, "[");
+	while (b->len < target) {
+		for (i = 0; i < depth; i++)
+			buf_puts(b, i % 2 ? "{\"k\":" : "[");
+		buf_puts(b, "0");
+		for (i = depth; i > 0; i--)
+			buf_puts(b, (i - 1) % 2 ? "}" : "]");
+		buf_puts(b, ",");
+	}
+	buf_trim_comma(b);
+	buf_puts(b, "]");
+}
+
+/* 宽对象，大量不同键 */
+static void gen_wide(bench_buf* b, size_t target) {
+	long i = 0;
+	buf_puts(b, "{");
+	while (b->len < target) {
+		buf_printf_int(b, "\"key_%ld\":", i++);
+		buf_printf_int(b, "%ld,", (long)(bench_rand() % 100000));
+	}
+	buf_trim_comma(b);
+	buf_puts(b, "}");
+}
+
+/* twitter.json 形状：记录数组，较多字符串与 unicode 转义 */
+static void gen_twitter(bench_buf* b, size_t target) {
+	long id = 505874924L;
+	buf_puts(b, "{\"statuses\":[");
+	while (b->len < target) {
+		buf_puts(b, "{\"metadata\":{\"result_type\":\"recent\","
+		            "\"iso_language_code\":\"ja\"},"
+		            "\"created_at\":\"Sun Aug 31 00:29:15 +0000 2014\",");
+		buf_printf_int(b, "\"id\":%ld,", id);
+		buf_printf_int(b, "\"id_str\":\"%ld\",", id);
+		buf_puts(b, "\"text\":\"@aym0566x \\n\\n\\u540d\\u524d:\\u524d\\u7530"
+		            "\\u3042\\u3086\\u307f ");
+		buf_rand_word(b, 40 + bench_rand() % 80);
+		buf_puts(b, "\",\"source\":\"<a href=\\\"http://twitter.com/download/"
+		            "iphone\\\" rel=\\\"nofollow\\\">Twitter for iPhone</a>\","
+		            "\"truncated\":false,\"in_reply_to_status_id\":null,"
+		            "\"user\":{");
+		buf_printf_int(b, "\"id\":%ld,", (long)(bench_rand() % 1000000000L));
+		buf_puts(b, "\"name\":\"");
+		buf_rand_word(b, 12);
+		buf_puts(b, "\",\"screen_name\":\"");
+		buf_rand_word(b, 10);
+		buf_puts(b, "\",\"location\":\"\\u57fc\\u7389\",\"description\":\"");
+		buf_rand_word(b, 60 + bench_rand() % 60);
+		buf_printf_int(b, "\",\"followers_count\":%ld,",
+		               (long)(bench_rand() % 100000));
+		buf_printf_int(b, "\"friends_count\":%ld,",
+		               (long)(bench_rand() % 10000));
+		buf_puts(b, "\"protected\":false,\"verified\":false,"
+		            "\"profile_background_color\":\"C0DEED\","
+		            "\"default_profile\":true},"
+		            "\"geo\":null,\"coordinates\":null,\"place\":null,");
+		buf_printf_int(b, "\"retweet_count\":%ld,", (long)(bench_rand() % 100));
+		buf_printf_int(b, "\"favorite_count\":%ld,",
+		               (long)(bench_rand() % 100));
+		buf_puts(b, "\"entities\":{\"hashtags\":[],\"symbols\":[],\"urls\":[],"
+		            "\"user_mentions\":[{\"screen_name\":\"aym0566x\","
+		            "\"name\":\"\\u524d\\u7530\\u3042\\u3086\\u307f\","
+		            "\"indices\":[0,9]}]},"
+		            "\"favorited\":false,\"retweeted\":false,\"lang\":\"ja\"},");
+		id++;
+	}
+	buf_trim_comma(b);
+	buf_puts(b, "],\"search_metadata\":{\"completed_in\":0.087,"
+	            "\"max_id\":505874924095815681,\"query\":\"%E4%B8%80\","
+	            "\"count\":100}}");
+}
+
+/* canada.json 形状：GeoJSON 多边形，大量高精度浮点坐标 */
+static void gen_canada(bench_buf* b, size_t target) {
+	buf_puts(b, "{\"type\":\"FeatureCollection\",\"features\":[{\"type\":"
+	            "\"Feature\",\"properties\":{\"name\":\"Canada\"},"
+	            "\"geometry\":{\"type\":\"Polygon\",\"coordinates\":[");
+	while (b->len < target) {
+		size_t i, n = 64 + bench_rand() % 512;
+		buf_puts(b, "[");
+		for (i = 0; i < n; i++) {
+			buf_printf_num(b, "[%.15f,", bench_rand_double(-141.0, -52.0));
+			buf_printf_num(b, "%.15f],", bench_rand_double(41.0, 84.0));
+		}
+		buf_trim_comma(b);
+		buf_puts(b, "],");
+	}
+	buf_trim_comma(b);
+	buf_puts(b, "]}}]}");
+}
+
+/* citm_catalog.json 形状：以整数 id 为主的嵌套对象和大量 null */
+static void gen_citm(bench_buf* b, size_t target) {
+	long id = 138586341L;
+	buf_puts(b, "{\"areaNames\":{\"205705993\":\"Arri\\u00e8re-sc\\u00e8ne "
+	            "central\",\"205705994\":\"1er balcon central\"},"
+	            "\"events\":{");
+	while (b->len < target / 2) {
+		buf_printf_int(b, "\"%ld\":{\"description\":null,", id);
+		buf_printf_int(b, "\"id\":%ld,\"logo\":null,\"name\":\"", id);
+		buf_rand_word(b, 20 + bench_rand() % 20);
+		buf_printf_int(b, "\",\"subTopicIds\":[337184269,%ld],",
+		               (long)(337184283L + bench_rand() % 100));
+		buf_printf_int(b, "\"subjectCode\":null,\"subtitle\":null,"
+		                  "\"topicIds\":[324846099,%ld]},",
+		               (long)(107888604L + bench_rand() % 100));
+		id++;
+	}
+	buf_trim_comma(b);
+	buf_puts(b, "},\"performances\":[");
+	while (b->len < target) {
+		buf_printf_int(b, "{\"eventId\":%ld,", (long)(138586341L +
+		                                              bench_rand() % 1000));
+		buf_printf_int(b, "\"id\":%ld,\"logo\":null,\"name\":null,",
+		               (long)(339887544L + bench_rand() % 100000));
+		buf_printf_int(b, "\"prices\":[{\"amount\":%ld,"
+		                  "\"audienceSubCategoryId\":337100890,"
+		                  "\"seatCategoryId\":338937295}],",
+		               (long)(bench_rand() % 100000));
+		buf_puts(b, "\"seatCategories\":[{\"areas\":[{\"areaId\":205705999,"
+		            "\"blockIds\":[]},{\"areaId\":205705998,\"blockIds\":[]}],"
+		            "\"seatCategoryId\":338937295}],\"seatMapImage\":null,");
+		buf_printf_int(b, "\"start\":%ld,", (long)(1372616400L +
+		                                          bench_rand() % 100000));
+		buf_puts(b, "\"venueCode\":\"PLEYEL_PLEYEL\"},");
+	}
+	buf_trim_comma(b);
+	buf_puts(b, "]}");
+}
+
+/* 按 4 空格缩进美化输出，用于衡量空白处理开销 */
+static void buf_prettify(bench_buf* out, const char* json) {
+	int depth = 0, in_string = 0, i;
+	const char* p;
+	for (p = json; *p; p++) {
+		char ch = *p;
+		buf_reserve(out, 4 * (size_t)depth + 8);
+		if (in_string) {
+			out->s[out->len++] = ch;
+			if (ch == '\\')
+				out->s[out->len++] = *++p;
+			else if (ch == '"')
+				in_string = 0;
+		} else if (ch == '{' || ch == '[') {
+			out->s[out->len++] = ch;
+			out->s[out->len++] = '\n';
+			for (i = 0, depth++; i < 4 * depth; i++)
+				out->s[out->len++] = ' ';
+		} else if (ch == '}' || ch == ']') {
+			out->s[out->len++] = '\n';
+			for (i = 0, depth--; i < 4 * depth; i++)
+				out->s[out->len++] = ' ';
+			out->s[out->len++] = ch;
+		} else if (ch == ',') {
+			out->s[out->len++] = ch;
+			out->s[out->len++] = '\n';
+			for (i = 0; i < 4 * depth; i++)
+				out->s[out->len++] = ' ';
+		} else if (ch == ':') {
+			out->s[out->len++] = ch;
+			out->s[out->len++] = ' ';
+		} else {
+			out->s[out->len++] = ch;
+			if (ch == '"')
+				in_string = 1;
+		}
+	}
+	out->s[out->len] = '\0';
+}
+
+/* 美化后的 twitter 形状文档 */
+static void gen_twitter_pretty(bench_buf* b, size_t target) {
+	bench_buf raw = {NULL, 0, 0};
+	gen_twitter(&raw, target);
+	buf_prettify(b, raw.s);
+	free(raw.s);
+}
+
+typedef struct {
+	const char* name;
+	void (*gen)(bench_buf* b, size_t target);
+	size_t target; /* 生成文档的目标大小 */
+} bench_doc;
+
+static const bench_doc bench_docs[] = {
+    {"numbers", gen_numbers, 1 << 20}, {"strings", gen_strings, 1 << 20},
+    {"nested", gen_nested, 1 << 20},   {"wide", gen_wide, 1 << 20},
+    {"twitter", gen_twitter, 600000},  {"canada", gen_canada, 2200000},
+    {"citm", gen_citm, 1700000},       {"pretty", gen_twitter_pretty, 600000},
+};
+
+/*********/
+/* 计时 */
+/*********/
+
+static double bench_now(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static int bench_cmp_double(const void* a, const void* b) {
+	double x = *(const double*)a, y = *(const double*)b;
+	return x < y ? -1 : x > y;
+}
+
+typedef struct {
+	double total;    /* 总耗时 (s) */
+	double p50, p99; /* 单次耗时分位数 (s) */
+} bench_stat;
+
+static void bench_summarize(double* t, size_t n, bench_stat* st) {
+	size_t i;
+	st->total = 0.0;
+	for (i = 0; i < n; i++)
+		st->total += t[i];
+	qsort(t, n, sizeof(double), bench_cmp_double);
+	st->p50 = t[n * 50 / 100];
+	st->p99 = t[n * 99 / 100 < n ? n * 99 / 100 : n - 1];
+}
+
+/*************/
+/* 堆内存统计 */
+/*************/
+
+/* 块前存放申请的大小，按最严格的对齐取块头 */
+typedef union {
+	size_t size;
+	long double ld;
+	void* p;
+} bench_block_head;
+
+typedef struct {
+	size_t live, peak; /* 当前占用与峰值，不计块头 */
+} bench_heap;
+
+static void* bench_heap_alloc(void* user, size_t size) {
+	bench_heap* h = (bench_heap*)user;
+	bench_block_head* b =
+	    (bench_block_head*)malloc(sizeof(bench_block_head) + size);
+	if (b == NULL)
+		return NULL;
+	b->size = size;
+	h->live += size;
+	if (h->live > h->peak)
+		h->peak = h->live;
+	return b + 1;
+}
+
+static void* bench_heap_realloc(void* user, void* p, size_t size) {
+	bench_heap* h = (bench_heap*)user;
+	bench_block_head* b;
+	size_t old;
+	if (p == NULL)
+		return bench_heap_alloc(user, size);
+	b = (bench_block_head*)p - 1;
+	old = b->size;
+	b = (bench_block_head*)realloc(b, sizeof(bench_block_head) + size);
+	if (b == NULL)
+		return NULL;
+	b->size = size;
+	h->live = h->live - old + size;
+	if (h->live > h->peak)
+		h->peak = h->live;
+	return b + 1;
+}
+
+static void bench_heap_free(void* user, void* p) {
+	bench_block_head* b = (bench_block_head*)p - 1;
+	((bench_heap*)user)->live -= b->size;
+	free(b);
+}
+
+/* 每个文档的 lept_parse 结果占用的堆内存与解析过程中的峰值 */
+typedef struct {
+	size_t bytes;    /* 输入字节数 */
+	size_t retained; /* 解析结果占用 */
+	size_t peak;     /* 解析过程中的峰值，含解析栈 */
+} bench_mem;
+
+static void bench_measure_heap(const char* json, size_t len, bench_mem* mem) {
+	bench_heap h = {0, 0};
+	lept_allocator a;
+	lept_value v;
+
+	/* 只在测量期间替换全局分配器，其余阶段的计时不受影响 */
+	a.alloc = bench_heap_alloc;
+	a.realloc = bench_heap_realloc;
+	a.free = bench_heap_free;
+	a.user = &h;
+	lept_set_allocator(&a);
+	lept_value_init(&v);
+	lept_parse(&v, json);
+	mem->bytes = len;
+	mem->retained = h.live;
+	mem->peak = h.peak;
+	lept_free(&v);
+	lept_set_allocator(NULL);
+}
+
+/* 阶段：parse, stringify, free，内存池模式的解析与整体释放，原地解析， */
+/* 只汇总数值、不构造 lept_value 树的事件式解析，以及不访问结果的按需解析 */
+enum {
+	PHASE_PARSE,
+	PHASE_STRINGIFY,
+	PHASE_FREE,
+	PHASE_ARENA_PARSE,
+	PHASE_ARENA_FREE,
+	PHASE_INSITU_PARSE,
+	PHASE_SAX_PARSE,
+	PHASE_LAZY_PARSE,
+	PHASE_COUNT
+};
+static const char* const bench_phase_names[PHASE_COUNT] = {
+    "parse", "stringify", "free", "arena_parse", "arena_free",
+    "insitu_parse", "sax_parse", "lazy_parse"};
+
+static int bench_sax_number(void* user, double n) {
+	*(double*)user += n;
+	return 0;
+}
+
+static const lept_handler bench_sax_handler = {
+    NULL, NULL, bench_sax_number, NULL, NULL, NULL, NULL, NULL, NULL};
+
+static int bench_run_doc(const bench_doc* d, double scale, FILE* out,
+                         int* first, bench_mem* mem) {
+	bench_buf b = {NULL, 0, 0};
+	bench_stat st[PHASE_COUNT];
+	double* t[PHASE_COUNT];
+	size_t i, p, iterations, out_len = 0;
+	lept_value v;
+	lept_arena arena;
+	char* json;
+	char* insitu;
+	int ret = 0;
+
+	/* 每个文档使用相同种子，保证单独运行某个文档时语料一致 */
+	bench_seed = 20230416UL;
+	d->gen(&b, (size_t)(d->target * scale));
+
+	/* 正确性检查：必须能解析，生成结果需能被重新解析且相等 */
+	lept_value_init(&v);
+	if (lept_parse(&v, b.s) != LEPT_PARSE_OK) {
+		fprintf(stderr, "%s: parse failed\n", d->name);
+		free(b.s);
+		return 1;
+	}
+	json = lept_stringify(&v, &out_len);
+	{
+		lept_value v2;
+		lept_value_init(&v2);
+		if (lept_parse(&v2, json) != LEPT_PARSE_OK || !lept_is_equal(&v, &v2)) {
+			fprintf(stderr, "%s: roundtrip mismatch\n", d->name);
+			ret = 1;
+		}
+		lept_free(&v2);
+	}
+	free(json);
+	lept_free(&v);
+	if (ret) {
+		free(b.s);
+		return ret;
+	}
+	bench_measure_heap(b.s, b.len, mem);
+
+	iterations = (size_t)(BENCH_TARGET_BYTES * scale) / b.len;
+	if (iterations < BENCH_MIN_ITERATIONS)
+		iterations = BENCH_MIN_ITERATIONS;
+	for (p = 0; p < PHASE_COUNT; p++)
+		t[p] = (double*)malloc(iterations * sizeof(double));
+
+	lept_arena_init(&arena, 0);
+	insitu = (char*)malloc(b.len + 1);
+	for (i = 0; i < iterations; i++) {
+		double t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, sum = 0.0;
+		lept_value_init(&v);
+		t0 = bench_now();
+		lept_parse(&v, b.s);
+		t1 = bench_now();
+		json = lept_stringify(&v, NULL);
+		t2 = bench_now();
+		lept_free(&v);
+		t3 = bench_now();
+		lept_parse_arena(&v, b.s, &arena);
+		t4 = bench_now();
+		lept_arena_free(&arena);
+		t5 = bench_now();
+		/* 原地解析会改写输入，每次使用新的副本 */
+		memcpy(insitu, b.s, b.len + 1);
+		t6 = bench_now();
+		lept_parse_insitu(&v, insitu);
+		t7 = bench_now();
+		lept_free(&v);
+		t8 = bench_now();
+		lept_parse_sax(b.s, &bench_sax_handler, &sum);
+		t8 = bench_now() - t8;
+		t9 = bench_now();
+		lept_parse_lazy(&v, b.s);
+		lept_free(&v);
+		t9 = bench_now() - t9;
+		/* 生成结果的释放不计入任何阶段 */
+		free(json);
+		t[PHASE_PARSE][i] = t1 - t0;
+		t[PHASE_STRINGIFY][i] = t2 - t1;
+		t[PHASE_FREE][i] = t3 - t2;
+		t[PHASE_ARENA_PARSE][i] = t4 - t3;
+		t[PHASE_ARENA_FREE][i] = t5 - t4;
+		t[PHASE_INSITU_PARSE][i] = t7 - t6;
+		t[PHASE_SAX_PARSE][i] = t8;
+		t[PHASE_LAZY_PARSE][i] = t9;
+	}
+
+	for (p = 0; p < PHASE_COUNT; p++) {
+		/* stringify 以输出字节计算吞吐，其余以输入字节计算 */
+		size_t bytes = p == PHASE_STRINGIFY ? out_len : b.len;
+		double mbs, dps;
+		bench_summarize(t[p], iterations, &st[p]);
+		mbs = (double)bytes * iterations / st[p].total / (1024.0 * 1024.0);
+		dps = (double)iterations / st[p].total;
+		printf("%-8s %-12s %10lu %8.1f %10.1f %10.1f %10.1f\n", d->name,
+		       bench_phase_names[p], (unsigned long)bytes, mbs, dps,
+		       st[p].p50 * 1e6, st[p].p99 * 1e6);
+		if (out != NULL) {
+			fprintf(out,
+			        "%s\n  {\"doc\":\"%s\",\"phase\":\"%s\",\"bytes\":%lu,"
+			        "\"iterations\":%lu,\"mb_per_s\":%.3f,\"docs_per_s\":%.3f,"
+			        "\"p50_us\":%.3f,\"p99_us\":%.3f}",
+			        *first ? "" : ",", d->name, bench_phase_names[p],
+			        (unsigned long)bytes, (unsigned long)iterations, mbs, dps,
+			        st[p].p50 * 1e6, st[p].p99 * 1e6);
+			*first = 0;
+		}
+		free(t[p]);
+	}
+
+	free(insitu);
+	free(b.s);
+	return 0;
+}
+
+static void usage(const char* prog) {
+	fprintf(stderr,
+	        "usage: %s [-o results.json] [-s scale] [doc...]\n"
+	        "  -o FILE   write machine-readable results (JSON) to FILE\n"
+	        "  -s SCALE  scale document sizes and iteration budget\n"
+	        "docs: numbers strings nested wide twitter canada citm pretty\n",
+	        prog);
+}
+
+int main(int argc, char* argv[]) {
+	const char* out_path = NULL;
+	double scale = 1.0;
+	FILE* out = NULL;
+	int i, first = 1, ret = 0, selected = 0;
+	size_t d;
+	bench_mem mem[sizeof(bench_docs) / sizeof(bench_docs[0])];
+	int measured[sizeof(bench_docs) / sizeof(bench_docs[0])];
+	int wanted[sizeof(bench_docs) / sizeof(bench_docs[0])];
+
+	memset(wanted, 0, sizeof(wanted));
+	for (i = 1; i < argc; i++) {
+		/* 选项的参数在此跳过，不作为文档名 */
+		if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+			out_path = argv[++i];
+		else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+			scale = atof(argv[++i]);
+		else if (argv[i][0] == '-') {
+			usage(argv[0]);
+			return 1;
+		} else {
+			for (d = 0; d < sizeof(bench_docs) / sizeof(bench_docs[0]); d++)
+				if (strcmp(argv[i], bench_docs[d].name) == 0)
+					break;
+			if (d == sizeof(bench_docs) / sizeof(bench_docs[0])) {
+				fprintf(stderr, "unknown doc: %s\n", argv[i]);
+				usage(argv[0]);
+				return 1;
+			}
+			wanted[d] = 1;
+			selected = 1;
+		}
+	}
+	if (scale <= 0.0) {
+		usage(argv[0]);
+		return 1;
+	}
+
+	if (out_path != NULL && (out = fopen(out_path, "w")) == NULL) {
+		perror(out_path);
+		return 1;
+	}
+	if (out != NULL)
+		fprintf(out, "{\"results\":[");
+
+	printf("%-8s %-12s %10s %8s %10s %10s %10s\n", "doc", "phase", "bytes",
+	       "MB/s", "docs/s", "p50(us)", "p99(us)");
+	for (d = 0; d < sizeof(bench_docs) / sizeof(bench_docs[0]); d++) {
+		measured[d] = 0;
+		if (selected && !wanted[d])
+			continue;
+		if (bench_run_doc(&bench_docs[d], scale, out, &first, &mem[d]) != 0)
+			ret = 1;
+		else
+			measured[d] = 1;
+	}
+
+	/* 解析结果占用的堆内存，用于比较不同值布局 */
+	printf("\n%-8s %10s %12s %12s %10s\n", "doc", "bytes", "heap", "heap_peak",
+	       "heap/bytes");
+	if (out != NULL)
+		fprintf(out, "\n],\"memory\":[");
+	for (d = 0, first = 1; d < sizeof(bench_docs) / sizeof(bench_docs[0]);
+	     d++) {
+		if (!measured[d])
+			continue;
+		printf("%-8s %10lu %12lu %12lu %10.2f\n", bench_docs[d].name,
+		       (unsigned long)mem[d].bytes, (unsigned long)mem[d].retained,
+		       (unsigned long)mem[d].peak,
+		       (double)mem[d].retained / (double)mem[d].bytes);
+		if (out != NULL) {
+			fprintf(out,
+			        "%s\n  {\"doc\":\"%s\",\"bytes\":%lu,\"heap_bytes\":%lu,"
+			        "\"heap_peak_bytes\":%lu}",
+			        first ? "" : ",", bench_docs[d].name,
+			        (unsigned long)mem[d].bytes, (unsigned long)mem[d].retained,
+			        (unsigned long)mem[d].peak);
+			first = 0;
+		}
+	}
+
+	if (out != NULL) {
+		fprintf(out, "\n]}\n");
+		fclose(out);
+	}
+	return ret;
+}
@@ -1,12 +1,44 @@
+/* 文件映射需要 POSIX 扩展声明及 64 位文件偏移，须在所有头文件之前定义 */
+#if !defined(_WIN32)
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE
+#endif
+#ifndef _FILE_OFFSET_BITS
+#define _FILE_OFFSET_BITS 64
+#endif
+#endif
+
 #include "leptjson.h"
 #include <assert.h>
-#include <errno.h>
+#include <locale.h>
 #include <math.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+/* 支持 mmap 的平台直接映射文件解析，其余平台读入缓冲区 */
+#if defined(__unix__) || defined(__unix) || \
+    (defined(__APPLE__) && defined(__MACH__))
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define LEPT_HAVE_MMAP 1
+#endif
+
+/* SIMD 加速，按编译目标选择指令集 */
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#ifndef __SSE2__
+#define __SSE2__ 1
+#endif
+#endif
+
 /* 此处定义而非头文件中实现封装 */
 /* static 函数只有当前文件可见 */
 
@@ -20,6 +52,102 @@
 #define LEPT_PARSE_STRINGIFY_INIT_SIZE 256
 #endif
 
+/* 流式生成时每次交给写出函数的块大小 */
+#ifndef LEPT_STRINGIFY_CHUNK_SIZE
+#define LEPT_STRINGIFY_CHUNK_SIZE 16384
+#endif
+
+/* 内存池默认块大小 */
+#ifndef LEPT_ARENA_CHUNK_SIZE
+#define LEPT_ARENA_CHUNK_SIZE 65536
+#endif
+
+/* 容量达到该值的对象在成员之后附带散列索引 */
+#ifndef LEPT_OBJECT_INDEX_MIN
+#define LEPT_OBJECT_INDEX_MIN 16
+#endif
+
+/* lept_is_equal 在栈上记录成员匹配下标的对象大小上限，更大的对象使用堆 */
+#ifndef LEPT_EQUAL_MATCH_STACK
+#define LEPT_EQUAL_MATCH_STACK 16
+#endif
+
+/* lept_value.flags 标志位 */
+#define LEPT_FLAG_BORROWED 0x1      /* 字符串、元素、成员存储不归该值所有 */
+#define LEPT_FLAG_BORROWED_KEYS 0x2 /* 对象成员的键不归该值所有 */
+#define LEPT_FLAG_LAZY 0x4          /* 尚未解码，只记录原文位置 */
+#define LEPT_FLAG_INLINE 0x8        /* 短字符串存于 u.i 中 */
+
+/* 值的字段访问，两种布局下写法一致 */
+/* 紧凑布局的元素、成员存储之前为记录容量的块头，空存储（NULL）容量为 0 */
+#ifdef LEPT_COMPACT
+typedef union {
+	size_t capacity;
+	double align; /* 保证块头之后的存储按 lept_value 对齐 */
+} lept_storage_head;
+#define LEPT_STORAGE_HEAD sizeof(lept_storage_head)
+#define LEPT_STORAGE_CAP(p)                                                 \
+	((p) != NULL ? ((lept_storage_head*)(void*)(p) - 1)->capacity : 0)
+#define LEPT_STORAGE_SET_CAP(p, n)                                          \
+	do {                                                                    \
+		if ((p) != NULL)                                                    \
+			((lept_storage_head*)(void*)(p) - 1)->capacity = (n);           \
+	} while (0)
+
+#define LEPT_MEMBERS(v) ((v)->u.m)
+#define LEPT_NMEMBERS(v) ((v)->len)
+#define LEPT_MCAP(v) LEPT_STORAGE_CAP(LEPT_MEMBERS(v))
+#define LEPT_SET_MCAP(v, n) LEPT_STORAGE_SET_CAP(LEPT_MEMBERS(v), n)
+#define LEPT_ELEMS(v) ((v)->u.e)
+#define LEPT_NELEMS(v) ((v)->len)
+#define LEPT_ECAP(v) LEPT_STORAGE_CAP(LEPT_ELEMS(v))
+#define LEPT_SET_ECAP(v, n) LEPT_STORAGE_SET_CAP(LEPT_ELEMS(v), n)
+#define LEPT_SPTR(v) ((v)->u.s)
+#define LEPT_SLEN(v) ((v)->len)
+#define LEPT_LJSON(v) ((v)->u.json)
+#define LEPT_LLEN(v) ((v)->len)
+
+/* 长度、元素数与成员数存于 32 位字段，可在编译时定义更小的上限 */
+#ifndef LEPT_LEN_MAX
+#define LEPT_LEN_MAX 0xFFFFFFFFUL
+#endif
+#else
+#define LEPT_STORAGE_HEAD 0
+
+#define LEPT_MEMBERS(v) ((v)->u.o.m)
+#define LEPT_NMEMBERS(v) ((v)->u.o.size)
+#define LEPT_MCAP(v) ((v)->u.o.capacity)
+#define LEPT_SET_MCAP(v, n) ((v)->u.o.capacity = (n))
+#define LEPT_ELEMS(v) ((v)->u.a.e)
+#define LEPT_NELEMS(v) ((v)->u.a.size)
+#define LEPT_ECAP(v) ((v)->u.a.capacity)
+#define LEPT_SET_ECAP(v, n) ((v)->u.a.capacity = (n))
+#define LEPT_SPTR(v) ((v)->u.s.s)
+#define LEPT_SLEN(v) ((v)->u.s.len)
+#define LEPT_LJSON(v) ((v)->u.l.json)
+#define LEPT_LLEN(v) ((v)->u.l.len)
+
+#define LEPT_LEN_MAX ((size_t)-1)
+#endif
+
+/* 值内字符串的最大长度，u.i 末字节存放 LEPT_INLINE_MAX - len */
+/* 长度恰为 LEPT_INLINE_MAX 时末字节为 0，同时作为结尾的 '\0' */
+#define LEPT_INLINE_MAX (sizeof(((lept_value*)0)->u.i) - 1)
+
+/* 字符串值的内容与长度，不论是否存于值内 */
+#define LEPT_STR(v) ((v)->flags & LEPT_FLAG_INLINE ? (v)->u.i : LEPT_SPTR(v))
+#define LEPT_STRLEN(v)                                                      \
+	((v)->flags & LEPT_FLAG_INLINE                                          \
+	     ? LEPT_INLINE_MAX - (unsigned char)(v)->u.i[LEPT_INLINE_MAX]       \
+	     : LEPT_SLEN(v))
+
+/* 按需解析的值在首次访问时解码，读取接口在逻辑上仍不修改值 */
+#define LEPT_LOAD(v)                                  \
+	do {                                              \
+		if ((v)->flags & LEPT_FLAG_LAZY)              \
+			lept_lazy_load((lept_value*)(v));         \
+	} while (0)
+
 #define EXPECT(c, ch)             \
 	do {                          \
 		assert(*c->json == (ch)); \
@@ -36,18 +164,158 @@
 	do {                                           \
 		memcpy(lept_context_push(c, len), s, len); \
 	} while (0)
+/* 生成结果写入，流式生成时按块写出 */
+#define OUTC(c, ch)                          \
+	do {                                     \
+		if ((c)->top + 1 >= (c)->size)       \
+			lept_stringify_grow(c, 1);       \
+		(c)->stack[(c)->top++] = (char)(ch); \
+	} while (0)
+#define OUTS(c, s, len)                              \
+	do {                                             \
+		memcpy(lept_stringify_push(c, len), s, len); \
+	} while (0)
+/* 读取 p 处字符，越过输入末尾 end 时返回 '\0' */
+#define PEEK_AT(p, end) ((p) < (end) ? *(p) : '\0')
+#define PEEK(c) PEEK_AT((c)->json, (c)->end)
 #define STRING_ERROR(ret) \
 	do {                  \
 		c->top = head;    \
 		return ret;       \
 	} while (0)
 
+/* 调用者缓冲区写满后，其余输出经该大小的临时区计算长度 */
+#define LEPT_STRINGIFY_SPILL_SIZE 256
+
+/* lept_stringify_buffer 的输出位置 */
+typedef struct {
+	char* buf;
+	size_t size, len; /* len 为完整输出的长度，可超过 size */
+	char spill[LEPT_STRINGIFY_SPILL_SIZE];
+} lept_stringify_buf;
+
+/* 解析中尚未闭合的数组或对象 */
+typedef struct {
+	lept_type type; /* LEPT_ARRAY 或 LEPT_OBJECT */
+	size_t size;    /* 已解析的元素或成员数 */
+} lept_frame;
+
 typedef struct {
 	const char* json;
+	const char* end;   /* 输入末尾，不要求以 '\0' 结尾 */
+	const char* limit; /* 可读范围末尾，[end, limit) 为填充区 */
 	char* stack;
 	size_t size, top;
+	lept_arena* arena; /* 非空时解析结果分配于内存池 */
+	int insitu;        /* 字符串原地解码，值与键直接指向输入 */
+	lept_keypool* keys; /* 非空时对象的键取自键池 */
+	const lept_handler* handler; /* 解析事件处理函数 */
+	void* user;
+	lept_frame* frames; /* 嵌套栈，取代递归下降 */
+	size_t depth, frames_size;
+	const lept_allocator* alloc; /* 解析栈与嵌套栈的分配器 */
+	lept_write_fn write; /* 非空时生成结果按块交给写出函数 */
+	void* wuser;
+	int werr;            /* 写出函数返回过非 0，此后的输出被丢弃 */
+	lept_stringify_buf* sbuf; /* 非空时直接生成到调用者缓冲区 */
 } lept_context;
 
+/* 发出解析事件，回调返回非 0 时终止解析 */
+#define EMIT(c, cb, args)                                  \
+	((c)->handler->cb != NULL && (c)->handler->cb args != 0 \
+	     ? LEPT_PARSE_STOPPED                               \
+	     : LEPT_PARSE_OK)
+
+/* 紧凑布局下构造的值中长度、元素数与成员数不能超过 LEPT_LEN_MAX */
+/* 事件式解析不构造值，不受此限制 */
+#ifdef LEPT_COMPACT
+#define LEPT_LEN_OVERFLOW(c, n) \
+	((c)->handler == &lept_dom_handler && (uint64_t)(n) > LEPT_LEN_MAX)
+#else
+#define LEPT_LEN_OVERFLOW(c, n) 0
+#endif
+
+/* 解析得到的字符串与键是否归值所有 */
+#define LEPT_CONTEXT_OWNS_STRINGS(c) ((c)->arena == NULL && !(c)->insitu)
+#define LEPT_CONTEXT_OWNS_KEYS(c) \
+	(LEPT_CONTEXT_OWNS_STRINGS(c) && (c)->keys == NULL)
+
+/* 键池中的键 */
+typedef struct {
+	const char* k;
+	size_t klen;
+} lept_keypool_entry;
+
+/* 键的存储分配于内存池，散列表为开放定址（线性探测） */
+struct lept_keypool {
+	lept_arena a;
+	lept_keypool_entry* slots;
+	size_t size, capacity;
+};
+
+/* 推送式解析状态，结构状态下先跳过空白 */
+enum {
+	LEPT_PUSH_VALUE,        /* 期待值 */
+	LEPT_PUSH_ARRAY_FIRST,  /* '[' 之后，期待值或 ']' */
+	LEPT_PUSH_ARRAY_NEXT,   /* 元素之后，期待 ',' 或 ']' */
+	LEPT_PUSH_OBJECT_FIRST, /* '{' 之后，期待键或 '}' */
+	LEPT_PUSH_OBJECT_KEY,   /* ',' 之后，期待键 */
+	LEPT_PUSH_OBJECT_COLON, /* 键之后，期待 ':' */
+	LEPT_PUSH_OBJECT_NEXT,  /* 成员之后，期待 ',' 或 '}' */
+	LEPT_PUSH_END,          /* 根值之后，只允许空白 */
+	LEPT_PUSH_STRING,       /* 跨块的字符串值 */
+	LEPT_PUSH_KEY,          /* 跨块的键 */
+	LEPT_PUSH_NUMBER,       /* 跨块的数值 */
+	LEPT_PUSH_LITERAL       /* 跨块的 null / false / true */
+};
+
+struct lept_push_parser {
+	lept_context c; /* 由 DOM 构造函数建树，嵌套栈同 lept_parse */
+	int state;
+	int ret;       /* 出现错误后忽略此后的输入 */
+	char* token;   /* 跨块的字符串或数值原文 */
+	size_t token_len, token_size;
+	int escaped;   /* 字符串中的 '\\' 位于上一块末尾 */
+	const char* literal; /* 字面值中尚未匹配的部分 */
+	lept_type literal_type;
+	lept_allocator alloc; /* 解析器自身、c 中的栈与 token 的分配器 */
+};
+
+/* 可复用的解析器，解析栈与嵌套栈保持历史最大容量，跨多次解析复用 */
+struct lept_parser {
+	lept_context c;
+	lept_allocator alloc; /* 解析器自身与 c 中的栈的分配器 */
+};
+
+/* 内存池块头，数据区紧随其后 */
+struct lept_arena_chunk {
+	lept_arena_chunk* next;
+	size_t size, used;
+};
+
+/* 内存池分配对齐，满足 double、指针与 size_t */
+typedef union {
+	double d;
+	void* p;
+	size_t s;
+} lept_arena_align;
+#define LEPT_ARENA_ROUND(n) \
+	(((n) + sizeof(lept_arena_align) - 1) & ~(sizeof(lept_arena_align) - 1))
+
+/* 默认分配器，直接调用 malloc、realloc、free */
+static void* lept_std_alloc(void* user, size_t size);
+static void* lept_std_realloc(void* user, void* p, size_t size);
+static void lept_std_free(void* user, void* p);
+
+/* 全局分配器，由 lept_set_allocator 设置 */
+static lept_allocator lept_heap = {lept_std_alloc, lept_std_realloc,
+                                   lept_std_free, NULL};
+
+/* 经分配器 a 分配、调整与释放，lept_mem_free 忽略 NULL */
+static void* lept_mem_alloc(const lept_allocator* a, size_t size);
+static void* lept_mem_realloc(const lept_allocator* a, void* p, size_t size);
+static void lept_mem_free(const lept_allocator* a, void* p);
+
 /* 释放 stack 空间 */
 static void lept_context_free(lept_context* c);
 
@@ -57,12 +325,181 @@ static void* lept_context_push(lept_context* c, size_t size);
 /* 出栈 */
 static void* lept_context_pop(lept_context* c, size_t size);
 
+/* 开始新的数组或对象，嵌套超过 LEPT_PARSE_MAX_DEPTH 层时返回 NULL */
+static lept_frame* lept_context_open(lept_context* c, lept_type type);
+
+/* 分配解析结果存储，内存池模式下由内存池分配 */
+static void* lept_context_alloc(lept_context* c, size_t size);
+
+/* 复制字符串并补充 '\0'，存储由 lept_context_alloc 分配 */
+static char* lept_context_strdup(lept_context* c, const char* s, size_t len);
+
+/* DOM 构造：作为事件处理函数，将值依次压入解析栈 */
+/* 键与值一样以字符串值入栈，数组（对象）结束时栈顶元素（键值对）出栈装入 */
+static lept_value* lept_dom_push(lept_context* c, lept_type type);
+static int lept_dom_null(void* user);
+static int lept_dom_bool(void* user, int b);
+static int lept_dom_number(void* user, double n);
+static int lept_dom_string(void* user, const char* s, size_t len);
+static int lept_dom_end_object(void* user, size_t size);
+static int lept_dom_end_array(void* user, size_t size);
+
+/* 键不存于值内，对象结束时直接转为成员的键 */
+static int lept_dom_key(void* user, const char* k, size_t klen);
+
+/* 出错时释放栈中已构造的值 */
+static void lept_dom_clear(lept_context* c);
+
+/* 返回键池中与 k 相同的键，不存在时加入 */
+static const char* lept_keypool_intern(lept_keypool* kp, const char* k,
+                                       size_t klen);
+
+/* 长度不超过 LEPT_INLINE_MAX 的字符串存于值内 */
+static void lept_string_inline(lept_value* v, const char* s, size_t len);
+
+/* lept_parse 等使用的事件处理函数，开始事件无需处理 */
+static const lept_handler lept_dom_handler = {
+    lept_dom_null,   lept_dom_bool, lept_dom_number,
+    lept_dom_string, lept_dom_key,  NULL,
+    lept_dom_end_object, NULL,       lept_dom_end_array};
+
+/* 创建解析上下文，输入为 [json, json + len)，其后 padding 字节可读 */
+static lept_context* lept_context_new(const char* json, size_t len,
+                                      size_t padding);
+
+/* 设置新的输入，保留已分配的解析栈与嵌套栈 */
+static void lept_context_reset(lept_context* c, const char* json, size_t len,
+                               size_t padding);
+
+/* 解析整个输入：单个值，前后允许空白 */
+static int lept_parse_document(lept_context* c);
+
+/* 构造 DOM 并装入 v，出错时释放已构造的值，c 可继续使用 */
+static int lept_parse_dom(lept_value* v, lept_context* c);
+
+/* 解析入口，同 lept_parse_dom，完成后释放 c */
+static int lept_parse_root(lept_value* v, lept_context* c);
+
+/* 读入整个文件流后解析，用于无法映射的文件 */
+static int lept_parse_stream(lept_value* v, FILE* fp);
+
+/* 推送式解析：处理一段输入，返回 LEPT_PARSE_OK 或错误 */
+static int lept_push_run(lept_push_parser* pp, const char* p, const char* end);
+
+/* 推送式解析：输入结束，按 lept_parse 遇到输入末尾的方式处理当前状态 */
+static int lept_push_eof(lept_push_parser* pp);
+
+/* 推送式解析：释放未完成的值，回到初始状态 */
+static void lept_push_reset(lept_push_parser* pp);
+
+/* 按需解析：跳过已校验的字符串、数组或对象原文，返回其后的位置 */
+static const char* lept_lazy_skip(const char* p, const char* end);
+
+/* 按需解析：读取 c->json 处已校验的值，字符串与容器只记录原文位置 */
+static void lept_lazy_value(lept_context* c, lept_value* v);
+
+/* 按需解析：解码 v 记录的原文，子值仍按需解码 */
+static void lept_lazy_load(lept_value* v);
+
+/* 分配元素、成员存储，c 为 NULL 时分配在堆上；size 为 0 时返回 NULL */
+static void* lept_alloc_storage(lept_context* c, size_t size);
+
+/* 调整元素、成员存储大小，存储不归该值所有时改为复制到堆上 */
+static void* lept_realloc_storage(lept_value* v, void* p, size_t old_size,
+                                  size_t new_size);
+
+/* 释放归该值所有的元素、成员存储 */
+static void lept_free_storage(void* p);
+
+/* 对象的键不归该值所有时逐个复制到堆上 */
+static void lept_own_object_keys(lept_value* v);
+
+/* 深拷贝所需的分配：pool 为 NULL 时分配在堆上，否则从 *pool 依次切分 */
+static void* lept_copy_alloc(char** pool, size_t size);
+
+/* 深拷贝 src 在 pool 中占用的字节数，与 lept_copy_value 的分配一一对应 */
+static size_t lept_copy_bytes(const lept_value* src);
+
+/* 深拷贝到未初始化的 dst，按源的容量一次分配，逐个复制成员，不查找键 */
+static void lept_copy_value(lept_value* dst, const lept_value* src,
+                            char** pool);
+
+/* 对象散列索引：容量不小于 LEPT_OBJECT_INDEX_MIN 时，成员存储中 */
+/* capacity 个成员之后为开放定址（线性探测）表，槽中为成员下标 + 1，0 为空 */
+/* 成员顺序不变，索引只加速按键查找 */
+
+/* 键的散列值 */
+static size_t lept_hash_key(const char* k, size_t klen);
+
+/* 64 位散列值的混合（splitmix64 的终结步骤） */
+static uint64_t lept_hash_mix(uint64_t h);
+
+/* lept_hash 的递归实现 */
+static uint64_t lept_hash_value(const lept_value* v);
+
+/* 只比较本层：类型、标量值以及数组（对象）的元素（成员）数 */
+/* 返回 0 表示不相等；返回 1 时若为数组或对象，仍需比较子值 */
+static int lept_is_equal_shallow(const lept_value* lhs, const lept_value* rhs);
+
+/* rhs 中与 lhs 第 i 个成员键相同的成员下标，键的顺序相同时无需查找 */
+static size_t lept_match_member(const lept_value* lhs, const lept_value* rhs,
+                                size_t i);
+
+/* 容量为 capacity 时的散列表槽数 */
+static size_t lept_object_slots(size_t capacity);
+
+/* 容量为 capacity 的成员存储（含索引）字节数 */
+static size_t lept_object_bytes(size_t capacity);
+
+/* 按新容量重新分配成员存储并重建索引 */
+static void lept_object_resize(lept_value* v, size_t capacity);
+
+/* 容量不足以容纳 size 个元素时的新容量，倍增且不小于 size */
+static size_t lept_grow_capacity(size_t capacity, size_t size);
+
+/* 删除后的容量：元素数降至容量的 1/4 及以下时减半至 2 * size，否则不变 */
+/* 与倍增扩容之间留出滞回区间，边界附近交替增删不会反复 realloc */
+static size_t lept_shrink_capacity(size_t capacity, size_t size);
+
+/* 在 index 处留出 count 个未初始化的位置并返回，其后元素整体后移 */
+/* count 为 0 时不做任何操作，返回 NULL */
+static lept_value* lept_array_open(lept_value* v, size_t index, size_t count);
+
+/* [e, e + count) 位于 v 的元素中时返回 e 的下标，否则返回 LEPT_KEY_NOT_EXIST */
+static size_t lept_array_offset(const lept_value* v, const lept_value* e,
+                                size_t count);
+
+/* 在 index 处留出 count 个位置后，原下标为 i 的元素 */
+static lept_value* lept_array_shifted(lept_value* v, size_t i, size_t index,
+                                      size_t count);
+
+/* 重建索引，成员存储分配或移动后调用 */
+static void lept_object_index_build(lept_value* v);
+
+/* 下标为 i 的成员加入索引 */
+static void lept_object_index_insert(lept_value* v, size_t i);
+
+/* 在末尾加入键为 key、值为 null 的成员，调用者保证键不存在 */
+/* key 可以位于 v 的成员中，扩容前先复制 */
+static lept_member* lept_object_append(lept_value* v, const char* key,
+                                       size_t klen);
+
+/* e 为 v 的某个成员值时返回该成员下标，否则返回 LEPT_KEY_NOT_EXIST */
+static size_t lept_object_offset(const lept_value* v, const lept_value* e);
+
+/* 下标为 i 的成员移出索引，其后成员下标减 1，须在释放键之前调用 */
+static void lept_object_index_remove(lept_value* v, size_t i);
+
+/* 跳过 [p, end) 中的连续空白，返回第一个非空白字符位置或 end */
+static const char* lept_skip_whitespace(const char* p, const char* end,
+                                        const char* lim);
+
 /* ws = *(%x20 / %x09 / %x0A / %x0D) */
 static void lept_parse_whitespace(lept_context* c);
 
 /* 重构 null false true */
-static int lept_parse_literal(lept_context* c, lept_value* v,
-                              const char* literal, lept_type type);
+static int lept_parse_literal(lept_context* c, const char* literal,
+                              lept_type type);
 
 /* if 0 ...... #endif 禁用代码 */
 #if 0
@@ -76,32 +513,72 @@ static int lept_parse_false(lept_context* c, lept_value* v);
 static int lept_parse_true(lept_context* c, lept_value* v);
 #endif
 
+/* 十进制尾数 w 与指数 q 转换为双精度浮点数 (Eisel-Lemire) */
+/* 成功时返回 1，结果位模式写入 *bits（不含符号位） */
+static int lept_eisel_lemire(uint64_t w, long q, uint64_t* bits);
+
+/* 困难情况回退，使用与区域设置无关的 strtod 转换 */
+static double lept_strtod_fallback(lept_context* c, const char* begin,
+                                   const char* end);
+
 /* number = [ "-" ] int [ frac ] [ exp ] */
-static int lept_parse_number(lept_context* c, lept_value* v);
+static int lept_parse_number(lept_context* c, double* n);
 
 /* 解析十六进制编码，转为十进制数值  */
-static const char* lept_parse_hex4(const char* p, unsigned* u);
+static const char* lept_parse_hex4(const char* p, const char* end,
+                                   unsigned* u);
+
+/* unicode 编码解析为 utf8，写入 buf 并返回字节数 */
+static size_t lept_encode_utf8(char* buf, unsigned u);
 
-/* unicode 编码解析为 utf8 */
-static void lept_encode_utf8(lept_context* c, unsigned u);
+/* 解析 '\\' 之后的转义序列，解码结果写入 buf（至多 4 字节） */
+/* 返回转义序列之后的位置，失败时返回 NULL 并由 *ret 给出错误 */
+/* 完整读取转义序列后才写入 buf，buf 可与输入重叠（原地解析） */
+static const char* lept_parse_escape(const char* p, const char* end,
+                                     char* buf, size_t* n, int* ret);
+
+/* 跳过字符串中无需转义处理的连续字符 */
+/* 返回 [p, end) 中第一个 '"'、'\\' 或控制字符的位置，不存在时返回 end */
+static const char* lept_scan_string(const char* p, const char* end,
+                                    const char* lim);
 
 /* 重构 string 解析函数 */
 /* 将 string 解析和装载分离 */
 static int lept_parse_string_raw(lept_context* c, char** str, size_t* len);
 
-/* string = "\"......\"" */
-static int lept_parse_string(lept_context* c, lept_value* v);
+/* 原地解析 string，解码结果写回输入缓冲区并补充 '\0' */
+static int lept_parse_string_insitu(lept_context* c, char** str, size_t* len);
 
-/* array = "[......]" */
-static int lept_parse_array(lept_context* c, lept_value* v);
+/* string = "\"......\""，key 为真时作为对象的键 */
+static int lept_parse_string(lept_context* c, int key);
 
-/* object = "{......}"" */
-static int lept_parse_object(lept_context* c, lept_value* v);
+/* 对象成员的 key ws ':' ws 部分 */
+static int lept_parse_key(lept_context* c);
 
 /* value = null / false / true / number / string / array / object */
-static int lept_parse_value(lept_context* c, lept_value* v);
+/* 语法解析只发出事件，值的构造由事件处理函数完成 */
+/* 数组与对象的嵌套记于 c->frames，不做递归，嵌套层数受 LEPT_PARSE_MAX_DEPTH 限制 */
+static int lept_parse_value(lept_context* c);
+
+/* 双精度浮点数转为最短可往返的十进制字符串 (Grisu2)，返回长度 */
+static int lept_dtoa(double d, char* buf);
+
+/* 为生成结果预留 size 字节；流式生成时先写出已满的块，size 不超过块大小 */
+static char* lept_stringify_push(lept_context* c, size_t size);
+
+/* 缓冲区空间不足：流式生成时写出已有内容，否则按 1.5 倍扩充 */
+static void lept_stringify_grow(lept_context* c, size_t size);
 
-/* 生成字符串 string */
+/* 流式生成：已生成的内容交给写出函数，清空缓冲区 */
+static void lept_stringify_flush(lept_context* c);
+
+/* 写入调用者缓冲区的写出函数，超出部分只计长度 */
+static int lept_stringify_buffer_write(void* user, const char* s, size_t len);
+
+/* 调用者缓冲区已满：已生成的部分留在原处，此后改为经临时区写出 */
+static void lept_stringify_spill(lept_context* c);
+
+/* 生成字符串 string，无需转义的连续字符由 lept_scan_string 整块找出后直接复制 */
 static void lept_stringify_string(lept_context* c, const char* s, size_t len);
 
 /* 生成 Json */
@@ -112,38 +589,360 @@ static void lept_stringify_value(lept_context* c, const lept_value* v);
 /*******************************/
 
 int lept_parse(lept_value* v, const char* json) {
+	assert(json != NULL);
+	return lept_parse_root(v, lept_context_new(json, strlen(json), 1));
+}
 
-	assert(v != NULL);
-	lept_value_init(v);
+int lept_parse_n(lept_value* v, const char* json, size_t len) {
+	assert(json != NULL || len == 0);
+	return lept_parse_root(v, lept_context_new(json, len, 0));
+}
 
-	lept_context* c = (lept_context*)malloc(sizeof(lept_context));
-	c->json = json;
-	c->stack = NULL;
-	c->size = c->top = 0;
+int lept_parse_padded(lept_value* v, const char* json, size_t len) {
+	assert(json != NULL);
+	return lept_parse_root(v, lept_context_new(json, len, LEPT_PARSE_PADDING));
+}
 
-	lept_parse_whitespace(c);
-	int ret = lept_parse_value(c, v);
+int lept_parse_insitu(lept_value* v, char* json) {
+	lept_context* c;
+	assert(json != NULL);
+	c = lept_context_new(json, strlen(json), 1);
+	c->insitu = 1;
+	return lept_parse_root(v, c);
+}
 
-	/* 完成解析后处理，对 LEPT_PARSE_ROOT_NOT_SINGULAR 情况进行判断 */
-	if (ret == LEPT_PARSE_OK) {
+int lept_parse_lazy(lept_value* v, const char* json) {
+	/* 校验时不处理任何事件，不构造值 */
+	static const lept_handler validate = {NULL, NULL, NULL, NULL, NULL,
+	                                      NULL, NULL, NULL, NULL};
+	lept_context* c;
+	const char *begin, *end;
+	int ret;
+	assert(v != NULL && json != NULL);
+	lept_value_init(v);
+	c = lept_context_new(json, strlen(json), 1);
+	c->handler = &validate;
+
+	/* 校验过程已得到根值的范围，无需再次跳过 */
+	lept_parse_whitespace(c);
+	begin = c->json;
+	if ((ret = lept_parse_value(c)) == LEPT_PARSE_OK) {
+		end = c->json;
 		lept_parse_whitespace(c);
-		if (*(c->json) != '\0') {
-			/* 此时解析已经完成，需要将 v 的值置空处理掉 */
+		if (c->json != c->end)
 			ret = LEPT_PARSE_ROOT_NOT_SINGULAR;
-			v->type = LEPT_NULL;
+		else if ((*begin == '"' || *begin == '[' || *begin == '{') &&
+		         (uint64_t)(end - begin) > LEPT_LEN_MAX)
+			/* 子值的原文都在根值之内，只需检查根值 */
+			ret = LEPT_PARSE_TOO_LONG;
+		else if (*begin == '"' || *begin == '[' || *begin == '{') {
+			LEPT_LJSON(v) = begin;
+			LEPT_LLEN(v) = (size_t)(end - begin);
+			v->type = *begin == '"' ? LEPT_STRING
+			          : *begin == '[' ? LEPT_ARRAY
+			                          : LEPT_OBJECT;
+			v->flags = LEPT_FLAG_LAZY;
+		} else {
+			c->json = begin;
+			lept_lazy_value(c, v);
 		}
 	}
-
 	lept_context_free(c);
+	return ret;
+}
+
+void lept_load(lept_value* v) {
+	size_t i;
+	assert(v != NULL);
+	/* 原文已校验，嵌套层数不超过 LEPT_PARSE_MAX_DEPTH */
+	LEPT_LOAD(v);
+	if (v->type == LEPT_ARRAY)
+		for (i = 0; i < LEPT_NELEMS(v); i++)
+			lept_load(&LEPT_ELEMS(v)[i]);
+	else if (v->type == LEPT_OBJECT)
+		for (i = 0; i < LEPT_NMEMBERS(v); i++)
+			lept_load(&LEPT_MEMBERS(v)[i].v);
+}
+
+void lept_set_allocator(const lept_allocator* a) {
+	if (a == NULL) {
+		lept_heap.alloc = lept_std_alloc;
+		lept_heap.realloc = lept_std_realloc;
+		lept_heap.free = lept_std_free;
+		lept_heap.user = NULL;
+	} else {
+		assert(a->alloc != NULL && a->realloc != NULL && a->free != NULL);
+		lept_heap = *a;
+	}
+}
+const lept_allocator* lept_get_allocator(void) { return &lept_heap; }
+
+void lept_arena_init(lept_arena* a, size_t chunk_size) {
+	lept_arena_init_allocator(a, chunk_size, NULL);
+}
+void lept_arena_init_allocator(lept_arena* a, size_t chunk_size,
+                               const lept_allocator* alloc) {
+	assert(a != NULL);
+	a->head = NULL;
+	a->chunk_size = chunk_size > 0 ? chunk_size : LEPT_ARENA_CHUNK_SIZE;
+	a->alloc = alloc != NULL ? *alloc : lept_heap;
+}
+void* lept_arena_alloc(lept_arena* a, size_t size) {
+	const size_t header = LEPT_ARENA_ROUND(sizeof(lept_arena_chunk));
+	lept_arena_chunk* chunk;
+	char* ret;
+	assert(a != NULL);
+
+	size = LEPT_ARENA_ROUND(size);
+	chunk = a->head;
+	if (chunk == NULL || chunk->size - chunk->used < size) {
+		/* 大块单独分配并挂在当前块之后，当前块剩余空间可继续使用 */
+		int large = size > a->chunk_size / 4;
+		size_t cap = large ? size : a->chunk_size;
+		chunk = (lept_arena_chunk*)lept_mem_alloc(&a->alloc, header + cap);
+		chunk->size = cap;
+		chunk->used = 0;
+		if (large && a->head != NULL) {
+			chunk->next = a->head->next;
+			a->head->next = chunk;
+		} else {
+			chunk->next = a->head;
+			a->head = chunk;
+		}
+	}
 
+	ret = (char*)chunk + header + chunk->used;
+	chunk->used += size;
 	return ret;
 }
+void lept_arena_free(lept_arena* a) {
+	assert(a != NULL);
+	while (a->head != NULL) {
+		lept_arena_chunk* next = a->head->next;
+		lept_mem_free(&a->alloc, a->head);
+		a->head = next;
+	}
+}
+
+int lept_parse_file(lept_value* v, const char* path, unsigned int flags) {
+#ifdef LEPT_HAVE_MMAP
+	struct stat st;
+	size_t len, page;
+	char* p;
+	int fd, ret, mflags = MAP_PRIVATE;
+	FILE* fp;
+
+	assert(v != NULL && path != NULL);
+	lept_value_init(v);
+	if ((fd = open(path, O_RDONLY)) < 0)
+		return LEPT_PARSE_FILE_ERROR;
+	if (fstat(fd, &st) != 0) {
+		close(fd);
+		return LEPT_PARSE_FILE_ERROR;
+	}
+
+	/* 管道等非普通文件无法映射，按流读取 */
+	if (!S_ISREG(st.st_mode)) {
+		if ((fp = fdopen(fd, "rb")) == NULL) {
+			close(fd);
+			return LEPT_PARSE_FILE_ERROR;
+		}
+		ret = lept_parse_stream(v, fp);
+		fclose(fp);
+		return ret;
+	}
+
+	/* 32 位平台上超出地址空间的文件无法映射 */
+	if ((uint64_t)st.st_size > (uint64_t)(size_t)-1) {
+		close(fd);
+		return LEPT_PARSE_FILE_ERROR;
+	}
+	len = (size_t)st.st_size;
+	if (len == 0) {
+		close(fd);
+		return lept_parse_n(v, NULL, 0);
+	}
+
+#ifdef MAP_POPULATE
+	if (flags & LEPT_FILE_POPULATE)
+		mflags |= MAP_POPULATE;
+#endif
+	p = (char*)mmap(NULL, len, PROT_READ, mflags, fd, 0);
+	close(fd);
+	if (p == (char*)MAP_FAILED)
+		return LEPT_PARSE_FILE_ERROR;
+
+	/* 建议内核顺序预读，咨询失败不影响解析 */
+	posix_madvise(p, len, POSIX_MADV_SEQUENTIAL);
+	if (flags & LEPT_FILE_POPULATE)
+		posix_madvise(p, len, POSIX_MADV_WILLNEED);
+#ifdef MADV_HUGEPAGE
+	if (flags & LEPT_FILE_HUGE_PAGES)
+		madvise(p, len, MADV_HUGEPAGE);
+#endif
+
+	/* 文件末尾没有 '\0'，末页中文件之后的部分可读（填 0），作为填充区 */
+	page = (size_t)sysconf(_SC_PAGESIZE);
+	ret = lept_parse_root(v, lept_context_new(p, len, (page - len % page) % page));
+	munmap(p, len);
+	return ret;
+#else
+	FILE* fp;
+	int ret;
+
+	assert(v != NULL && path != NULL);
+	(void)flags;
+	lept_value_init(v);
+	if ((fp = fopen(path, "rb")) == NULL)
+		return LEPT_PARSE_FILE_ERROR;
+	ret = lept_parse_stream(v, fp);
+	fclose(fp);
+	return ret;
+#endif
+}
+
+lept_push_parser* lept_push_parser_new(void) {
+	return lept_push_parser_new_allocator(NULL);
+}
+lept_push_parser* lept_push_parser_new_allocator(const lept_allocator* a) {
+	lept_push_parser* pp;
+	if (a == NULL)
+		a = &lept_heap;
+	pp = (lept_push_parser*)lept_mem_alloc(a, sizeof(lept_push_parser));
+	memset(pp, 0, sizeof(lept_push_parser));
+	pp->alloc = *a;
+	pp->c.alloc = &pp->alloc;
+	pp->c.handler = &lept_dom_handler;
+	pp->c.user = &pp->c;
+	pp->state = LEPT_PUSH_VALUE;
+	return pp;
+}
+int lept_push_parser_feed(lept_push_parser* pp, const char* chunk,
+                          size_t len) {
+	assert(pp != NULL && (chunk != NULL || len == 0));
+	if (pp->ret == LEPT_PARSE_OK && len > 0)
+		lept_push_run(pp, chunk, chunk + len);
+	return pp->ret;
+}
+int lept_push_parser_finish(lept_push_parser* pp, lept_value* v) {
+	int ret;
+	assert(pp != NULL && v != NULL);
+	lept_value_init(v);
+	if (pp->ret == LEPT_PARSE_OK)
+		lept_push_eof(pp);
+	if ((ret = pp->ret) == LEPT_PARSE_OK)
+		memcpy(v, lept_context_pop(&pp->c, sizeof(lept_value)),
+		       sizeof(lept_value));
+	lept_push_reset(pp);
+	return ret;
+}
+void lept_push_parser_free(lept_push_parser* pp) {
+	lept_allocator a;
+	if (pp == NULL)
+		return;
+	lept_push_reset(pp);
+	a = pp->alloc;
+	lept_mem_free(&a, pp->c.stack);
+	lept_mem_free(&a, pp->c.frames);
+	lept_mem_free(&a, pp->token);
+	lept_mem_free(&a, pp);
+}
+
+lept_parser* lept_parser_new(void) {
+	return lept_parser_new_allocator(NULL);
+}
+lept_parser* lept_parser_new_allocator(const lept_allocator* a) {
+	lept_parser* p;
+	if (a == NULL)
+		a = &lept_heap;
+	p = (lept_parser*)lept_mem_alloc(a, sizeof(lept_parser));
+	p->alloc = *a;
+	p->c.alloc = &p->alloc;
+	lept_context_reset(&p->c, NULL, 0, 0);
+	p->c.stack = NULL;
+	p->c.size = 0;
+	p->c.frames = NULL;
+	p->c.frames_size = 0;
+	return p;
+}
+int lept_parser_parse(lept_parser* p, lept_value* v, const char* json) {
+	assert(p != NULL && json != NULL);
+	lept_context_reset(&p->c, json, strlen(json), 1);
+	return lept_parse_dom(v, &p->c);
+}
+int lept_parser_parse_n(lept_parser* p, lept_value* v, const char* json,
+                        size_t len) {
+	assert(p != NULL && (json != NULL || len == 0));
+	lept_context_reset(&p->c, json, len, 0);
+	return lept_parse_dom(v, &p->c);
+}
+void lept_parser_free(lept_parser* p) {
+	lept_allocator a;
+	if (p == NULL)
+		return;
+	a = p->alloc;
+	lept_mem_free(&a, p->c.stack);
+	lept_mem_free(&a, p->c.frames);
+	lept_mem_free(&a, p);
+}
+
+int lept_parse_sax(const char* json, const lept_handler* h, void* user) {
+	lept_context* c;
+	int ret;
+	assert(json != NULL && h != NULL);
+	c = lept_context_new(json, strlen(json), 1);
+	c->handler = h;
+	c->user = user;
+	ret = lept_parse_document(c);
+	lept_context_free(c);
+	return ret;
+}
+
+lept_keypool* lept_keypool_new(void) {
+	lept_keypool* kp =
+	    (lept_keypool*)lept_mem_alloc(&lept_heap, sizeof(lept_keypool));
+	lept_arena_init(&kp->a, 0);
+	kp->slots = NULL;
+	kp->size = kp->capacity = 0;
+	return kp;
+}
+size_t lept_keypool_size(const lept_keypool* kp) {
+	assert(kp != NULL);
+	return kp->size;
+}
+void lept_keypool_free(lept_keypool* kp) {
+	if (kp == NULL)
+		return;
+	lept_arena_free(&kp->a);
+	lept_mem_free(&lept_heap, kp->slots);
+	lept_mem_free(&lept_heap, kp);
+}
+
+int lept_parse_keypool(lept_value* v, const char* json, lept_keypool* kp) {
+	lept_context* c;
+	assert(json != NULL && kp != NULL);
+	c = lept_context_new(json, strlen(json), 1);
+	c->keys = kp;
+	return lept_parse_root(v, c);
+}
+
+int lept_parse_arena(lept_value* v, const char* json, lept_arena* a) {
+	lept_context* c;
+	assert(json != NULL && a != NULL);
+	c = lept_context_new(json, strlen(json), 1);
+	c->arena = a;
+	return lept_parse_root(v, c);
+}
 
 char* lept_stringify(const lept_value* v, size_t* length) {
 	lept_context c;
 	assert(v != NULL);
-	c.stack = (char*)malloc(c.size = LEPT_PARSE_STRINGIFY_INIT_SIZE);
+	c.alloc = &lept_heap;
+	c.stack = (char*)lept_mem_alloc(c.alloc,
+	                                c.size = LEPT_PARSE_STRINGIFY_INIT_SIZE);
 	c.top = 0;
+	c.write = NULL;
+	c.sbuf = NULL;
 	lept_stringify_value(&c, v);
 	if (length)
 		*length = c.top;
@@ -151,46 +950,67 @@ char* lept_stringify(const lept_value* v, size_t* length) {
 	return c.stack;
 }
 
-void lept_copy(lept_value* dst, const lept_value* src) {
-	assert(src != NULL && dst != NULL && src != dst);
-	size_t i;
-	switch (src->type) {
-	case LEPT_STRING:
-		lept_set_string(dst, src->u.s.s, src->u.s.len);
-		break;
-	case LEPT_ARRAY:
-		lept_set_array(dst, src->u.a.capacity);
+int lept_stringify_to(const lept_value* v, lept_write_fn write, void* user) {
+	lept_context c;
+	assert(v != NULL && write != NULL);
+	c.alloc = &lept_heap;
+	c.stack =
+	    (char*)lept_mem_alloc(c.alloc, c.size = LEPT_STRINGIFY_CHUNK_SIZE);
+	c.top = 0;
+	c.write = write;
+	c.wuser = user;
+	c.werr = 0;
+	c.sbuf = NULL;
+	lept_stringify_value(&c, v);
+	lept_stringify_flush(&c);
+	lept_mem_free(c.alloc, c.stack);
+	return c.werr ? LEPT_STRINGIFY_WRITE_ERROR : LEPT_STRINGIFY_OK;
+}
 
-		/* 递归处理 */
-		/* 逐个调用 push_back 函数插入 */
-		for (i = 0; i < src->u.a.size; i++)
-			lept_pushback_array_element(dst, &src->u.a.e[i]);
+size_t lept_stringify_buffer(const lept_value* v, char* buf, size_t size) {
+	lept_context c;
+	lept_stringify_buf b;
+	assert(v != NULL && (buf != NULL || size == 0));
+	b.buf = buf;
+	b.size = size;
+	b.len = 0;
+
+	/* 直接生成到 buf，不分配内存；写满后只把放得下的部分复制进去 */
+	c.stack = buf;
+	c.size = size;
+	c.top = 0;
+	c.write = NULL;
+	c.sbuf = &b;
+	if (size == 0)
+		lept_stringify_spill(&c);
+	lept_stringify_value(&c, v);
+	if (c.write == NULL)
+		b.len = c.top;
+	else
+		lept_stringify_flush(&c);
+	if (size > 0)
+		buf[b.len < size ? b.len : size - 1] = '\0';
+	return b.len;
+}
 
-		break;
-	case LEPT_OBJECT:
-		lept_set_object(dst, src->u.o.capacity);
-
-		/* 递归处理 */
-		/* 调用 set_object_value_by_key 函数插入 */
-		for (i = 0; i < src->u.o.size; i++) {
-			lept_value* val = (lept_value*)malloc(sizeof(lept_value));
-			lept_value_init(val);
-
-			/* key-value */
-			lept_copy(val, &src->u.o.m[i].v);
-			lept_set_object_value_by_key(dst, src->u.o.m[i].k,
-			                             src->u.o.m[i].klen, val);
-
-			/* lept_free 只进行了内部空间的释放 */
-			lept_free(val);
-			free_ptr(val);
-		}
-		break;
-	default:
-		lept_free(dst);
-		memcpy(dst, src, sizeof(lept_value));
-		break;
-	}
+void lept_copy(lept_value* dst, const lept_value* src) {
+	lept_value v;
+	assert(src != NULL && dst != NULL && src != dst);
+	/* 先复制再释放，src 可以是 dst 的子值 */
+	lept_copy_value(&v, src, NULL);
+	lept_free(dst);
+	memcpy(dst, &v, sizeof(lept_value));
+}
+void lept_copy_arena(lept_value* dst, const lept_value* src, lept_arena* a) {
+	lept_value v;
+	size_t size;
+	char* pool;
+	assert(src != NULL && dst != NULL && src != dst && a != NULL);
+	size = lept_copy_bytes(src);
+	pool = size > 0 ? (char*)lept_arena_alloc(a, size) : NULL;
+	lept_copy_value(&v, src, &pool);
+	lept_free(dst);
+	memcpy(dst, &v, sizeof(lept_value));
 }
 void lept_move(lept_value* dst, lept_value* src) {
 	assert(dst != NULL && src != NULL && src != dst);
@@ -213,75 +1033,101 @@ void lept_free(lept_value* v) {
 	assert(v != NULL && v->type >= LEPT_NULL);
 
 	size_t i;
-	switch (v->type) {
+	/* 不归该值所有的存储（如内存池中）只做遍历，不释放 */
+	/* 未解码的值没有分配任何空间 */
+	switch (v->flags & LEPT_FLAG_LAZY ? LEPT_NULL : v->type) {
 	/* string 处理 */
 	case LEPT_STRING:
-		free_ptr(v->u.s.s);
+		if (!(v->flags & (LEPT_FLAG_BORROWED | LEPT_FLAG_INLINE)))
+			lept_mem_free(&lept_heap, LEPT_SPTR(v));
 		break;
 	/* array 处理 */
 	case LEPT_ARRAY:
 		/* 只有在 size 范围内元素才需要递归处理 */
-		for (i = 0; i < v->u.a.size; i++)
-			lept_free(&v->u.a.e[i]);
+		for (i = 0; i < LEPT_NELEMS(v); i++)
+			lept_free(&LEPT_ELEMS(v)[i]);
 
-		free_ptr(v->u.a.e);
+		if (!(v->flags & LEPT_FLAG_BORROWED))
+			lept_free_storage(LEPT_ELEMS(v));
 		break;
 	case LEPT_OBJECT:
 		/* 只有在 size 范围内元素才需要递归处理 */
-		for (i = 0; i < v->u.o.size; i++) {
-			free_ptr(v->u.o.m[i].k);
-			lept_free(&v->u.o.m[i].v);
+		for (i = 0; i < LEPT_NMEMBERS(v); i++) {
+			if (!(v->flags & LEPT_FLAG_BORROWED_KEYS))
+				lept_mem_free(&lept_heap, LEPT_MEMBERS(v)[i].k);
+			lept_free(&LEPT_MEMBERS(v)[i].v);
 		}
-		free_ptr(v->u.o.m);
+		if (!(v->flags & LEPT_FLAG_BORROWED))
+			lept_free_storage(LEPT_MEMBERS(v));
 		break;
 	default:
 		break;
 	}
 
 	v->type = LEPT_NULL;
+	v->flags = 0;
 }
 
 lept_type lept_get_type(const lept_value* v) { return v->type; }
 
 int lept_is_equal(const lept_value* lhs, const lept_value* rhs) {
-	size_t i;
+	size_t i, index, buf[LEPT_EQUAL_MATCH_STACK], *match;
+	const lept_value* l;
+	int ret = 1;
 	assert(lhs != NULL && rhs != NULL);
-	if (lhs->type != rhs->type)
+	if (!lept_is_equal_shallow(lhs, rhs))
 		return 0;
+
+	/* 同一段原文、标量均已比较完毕 */
+	if (lhs->flags & LEPT_FLAG_LAZY)
+		return 1;
 	switch (lhs->type) {
-	case LEPT_STRING:
-		return lhs->u.s.len == rhs->u.s.len &&
-		       memcmp(lhs->u.s.s, rhs->u.s.s, lhs->u.s.len) == 0;
-	case LEPT_NUMBER:
-		return lhs->u.n == rhs->u.n;
 	case LEPT_ARRAY:
-		if (lhs->u.a.size != rhs->u.a.size)
-			return 0;
-		for (i = 0; i < lhs->u.a.size; i++)
-			if (!lept_is_equal(&lhs->u.a.e[i], &rhs->u.a.e[i]))
-				return 0;
-		return 1;
-	case LEPT_OBJECT:
-		/* size comp */
-		if (lhs->u.o.size != rhs->u.o.size)
-			return 0;
-
-		/* key-value comp */
-		for (i = 0; i < lhs->u.o.size; i++) {
-			size_t index = lept_find_object_index(rhs, lhs->u.o.m[i].k,
-			                                      lhs->u.o.m[i].klen);
-			if (index == LEPT_KEY_NOT_EXIST)
+		/* 先比较全部子值的本层，再逐个深入 */
+		for (i = 0; i < LEPT_NELEMS(lhs); i++)
+			if (!lept_is_equal_shallow(&LEPT_ELEMS(lhs)[i],
+			                           &LEPT_ELEMS(rhs)[i]))
 				return 0;
-
-			if (!lept_is_equal(&lhs->u.o.m[i].v, &rhs->u.o.m[index].v))
+		for (i = 0; i < LEPT_NELEMS(lhs); i++) {
+			l = &LEPT_ELEMS(lhs)[i];
+			if ((l->type == LEPT_ARRAY || l->type == LEPT_OBJECT) &&
+			    !lept_is_equal(l, &LEPT_ELEMS(rhs)[i]))
 				return 0;
 		}
 		return 1;
+	case LEPT_OBJECT:
+		/* 本层匹配得到的下标留待深入时使用，每个成员只查找一次 */
+		match = LEPT_NMEMBERS(lhs) <= LEPT_EQUAL_MATCH_STACK
+		            ? buf
+		            : (size_t*)lept_mem_alloc(
+		                  &lept_heap, LEPT_NMEMBERS(lhs) * sizeof(size_t));
+		for (i = 0; ret && i < LEPT_NMEMBERS(lhs); i++) {
+			index = lept_match_member(lhs, rhs, i);
+			if (index == LEPT_KEY_NOT_EXIST ||
+			    !lept_is_equal_shallow(&LEPT_MEMBERS(lhs)[i].v,
+			                           &LEPT_MEMBERS(rhs)[index].v))
+				ret = 0;
+			match[i] = index;
+		}
+		for (i = 0; ret && i < LEPT_NMEMBERS(lhs); i++) {
+			l = &LEPT_MEMBERS(lhs)[i].v;
+			if ((l->type == LEPT_ARRAY || l->type == LEPT_OBJECT) &&
+			    !lept_is_equal(l, &LEPT_MEMBERS(rhs)[match[i]].v))
+				ret = 0;
+		}
+		if (match != buf)
+			lept_mem_free(&lept_heap, match);
+		return ret;
 	default:
 		return 1;
 	}
 }
 
+size_t lept_hash(const lept_value* v) {
+	assert(v != NULL);
+	return (size_t)lept_hash_value(v);
+}
+
 /* bollean */
 
 int lept_get_boolean(const lept_value* v) {
@@ -311,71 +1157,108 @@ void lept_set_number(lept_value* v, double n) {
 
 const char* lept_get_string(const lept_value* v) {
 	assert(v != NULL && v->type == LEPT_STRING);
-	return v->u.s.s;
+	LEPT_LOAD(v);
+	return LEPT_STR(v);
 }
 size_t lept_get_string_length(const lept_value* v) {
 	assert(v != NULL && v->type == LEPT_STRING);
-	return v->u.s.len;
+	LEPT_LOAD(v);
+	return LEPT_STRLEN(v);
 }
-void lept_set_string(lept_value* v, const char* s, size_t len) {
+int lept_set_string(lept_value* v, const char* s, size_t len) {
 
 	assert(v != NULL && (s != NULL || len == 0));
+	if ((uint64_t)len > LEPT_LEN_MAX)
+		return LEPT_PARSE_TOO_LONG;
 	lept_free(v);
+	v->type = LEPT_STRING;
+
+	/* 短字符串无需分配 */
+	if (len <= LEPT_INLINE_MAX) {
+		lept_string_inline(v, s, len);
+		return LEPT_PARSE_OK;
+	}
 
 	/* 执行深拷贝 */
-	v->u.s.s = (char*)malloc(len + 1);
-	memcpy(v->u.s.s, s, len);
+	LEPT_SPTR(v) = (char*)lept_mem_alloc(&lept_heap, len + 1);
+	memcpy(LEPT_SPTR(v), s, len);
 
 	/* 补充尾部 '\0' 字符 */
-	v->u.s.s[len] = '\0';
-	v->u.s.len = len;
+	LEPT_SPTR(v)[len] = '\0';
+	LEPT_SLEN(v) = len;
+	return LEPT_PARSE_OK;
+}
+int lept_set_string_adopt(lept_value* v, char* s, size_t len) {
+	assert(v != NULL && s != NULL);
+	if ((uint64_t)len > LEPT_LEN_MAX)
+		return LEPT_PARSE_TOO_LONG;
+	assert(s[len] == '\0');
+	lept_free(v);
 	v->type = LEPT_STRING;
+	LEPT_SPTR(v) = s;
+	LEPT_SLEN(v) = len;
+	return LEPT_PARSE_OK;
 }
 
 /* array */
 
-void lept_set_array(lept_value* v, size_t capacity) {
+int lept_set_array(lept_value* v, size_t capacity) {
 
 	assert(v != NULL);
+	if ((uint64_t)capacity > LEPT_LEN_MAX)
+		return LEPT_PARSE_TOO_LONG;
 	lept_free(v);
 
 	v->type = LEPT_ARRAY;
-	v->u.a.size = 0;
-	v->u.a.capacity = capacity;
-	v->u.a.e = capacity > 0 ? (lept_value*)malloc(capacity * sizeof(lept_value))
-	                        : NULL;
-	return;
+	LEPT_NELEMS(v) = 0;
+	LEPT_ELEMS(v) =
+	    (lept_value*)lept_alloc_storage(NULL, capacity * sizeof(lept_value));
+	LEPT_SET_ECAP(v, capacity);
+	return LEPT_PARSE_OK;
 }
 
 size_t lept_get_array_size(const lept_value* v) {
 	assert(v != NULL && v->type == LEPT_ARRAY);
-	return v->u.a.size;
+	LEPT_LOAD(v);
+	return LEPT_NELEMS(v);
 }
 size_t lept_get_array_capacity(const lept_value* v) {
 	assert(v != NULL && v->type == LEPT_ARRAY);
-	return v->u.a.capacity;
+	LEPT_LOAD(v);
+	return LEPT_ECAP(v);
 }
 
-void lept_reserve_array(lept_value* v, size_t capacity) {
+int lept_reserve_array(lept_value* v, size_t capacity) {
 	assert(v != NULL && v->type == LEPT_ARRAY);
-	if (v->u.a.capacity < capacity) {
-		v->u.a.capacity = capacity;
-		v->u.a.e =
-		    (lept_value*)realloc(v->u.a.e, capacity * sizeof(lept_value));
+	if ((uint64_t)capacity > LEPT_LEN_MAX)
+		return LEPT_PARSE_TOO_LONG;
+	LEPT_LOAD(v);
+	if (LEPT_ECAP(v) < capacity) {
+		LEPT_ELEMS(v) = (lept_value*)lept_realloc_storage(
+		    v, LEPT_ELEMS(v), LEPT_NELEMS(v) * sizeof(lept_value),
+		    capacity * sizeof(lept_value));
+		LEPT_SET_ECAP(v, capacity);
 	}
+	return LEPT_PARSE_OK;
 }
 /* 这直接把 capacity 设置成 size 大小 */
 void lept_shrink_array(lept_value* v) {
 	assert(v != NULL && v->type == LEPT_ARRAY);
-	if (v->u.a.capacity > v->u.a.size) {
-		v->u.a.capacity = v->u.a.size;
-		v->u.a.e = (lept_value*)realloc(v->u.a.e,
-		                                v->u.a.capacity * sizeof(lept_value));
+	LEPT_LOAD(v);
+	if (LEPT_ECAP(v) > LEPT_NELEMS(v)) {
+		LEPT_ELEMS(v) = (lept_value*)lept_realloc_storage(
+		    v, LEPT_ELEMS(v), LEPT_NELEMS(v) * sizeof(lept_value),
+		    LEPT_NELEMS(v) * sizeof(lept_value));
+		LEPT_SET_ECAP(v, LEPT_NELEMS(v));
 	}
 }
 void lept_clear_array(lept_value* v) {
+	size_t i;
 	assert(v != NULL && v->type == LEPT_ARRAY);
-	lept_erase_array_element(v, 0, v->u.a.size);
+	LEPT_LOAD(v);
+	for (i = 0; i < LEPT_NELEMS(v); i++)
+		lept_free(LEPT_ELEMS(v) + i);
+	LEPT_NELEMS(v) = 0;
 
 	/* clear 时容量剩余值不会改变 */
 	/* 需使用 lept_shrink_array 手动释放剩余内存 */
@@ -385,122 +1268,192 @@ void lept_clear_array(lept_value* v) {
 
 const lept_value* lept_get_array_element(const lept_value* v, size_t index) {
 	assert(v != NULL && v->type == LEPT_ARRAY);
-	assert(index < v->u.a.size);
-	return &v->u.a.e[index];
+	LEPT_LOAD(v);
+	assert(index < LEPT_NELEMS(v));
+	return &LEPT_ELEMS(v)[index];
 }
 void lept_pushback_array_element(lept_value* v, const lept_value* e) {
-	assert(v != NULL && e != NULL && v->type == LEPT_ARRAY);
-	if (v->u.a.size == v->u.a.capacity)
-		lept_reserve_array(v, v->u.a.capacity == 0 ? 1 : v->u.a.capacity * 2);
-
-	/* copy 前执行 init */
-	lept_value_init((v->u.a.e) + v->u.a.size);
-	lept_copy((v->u.a.e) + v->u.a.size, e);
-	v->u.a.size++;
+	lept_value tmp;
+	assert(e != NULL);
+	/* e 可能是 v 的元素，先复制再扩容，避免读取已移动或释放的位置 */
+	lept_value_init(&tmp);
+	lept_copy(&tmp, e);
+	memcpy(lept_emplace_back_array_element(v), &tmp, sizeof(lept_value));
+}
+void lept_pushback_array_element_move(lept_value* v, lept_value* e) {
+	lept_value tmp;
+	assert(e != NULL);
+	memcpy(&tmp, e, sizeof(lept_value));
+	lept_value_init(e);
+	memcpy(lept_emplace_back_array_element(v), &tmp, sizeof(lept_value));
+}
+lept_value* lept_emplace_back_array_element(lept_value* v) {
+	lept_value* e;
+	assert(v != NULL && v->type == LEPT_ARRAY);
+	LEPT_LOAD(v);
+	e = lept_array_open(v, LEPT_NELEMS(v), 1);
+	lept_value_init(e);
+	return e;
+}
+void lept_append_array_range(lept_value* v, const lept_value* e,
+                             size_t count) {
+	assert(v != NULL && v->type == LEPT_ARRAY);
+	LEPT_LOAD(v);
+	lept_insert_array_range(v, e, count, LEPT_NELEMS(v));
 }
 void lept_popback_array_element(lept_value* v) {
-	assert(v != NULL && v->type == LEPT_ARRAY && v->u.a.size > 0);
-	v->u.a.size--;
-	lept_free((v->u.a.e) + v->u.a.size);
+	assert(v != NULL && v->type == LEPT_ARRAY);
+	LEPT_LOAD(v);
+	assert(LEPT_NELEMS(v) > 0);
+	LEPT_NELEMS(v)--;
+	lept_free((LEPT_ELEMS(v)) + LEPT_NELEMS(v));
 }
 void lept_insert_array_element(lept_value* v, const lept_value* e,
                                size_t index) {
-	assert(v != NULL && v->type == LEPT_ARRAY && index <= v->u.a.size);
-
-	/* 首先插入尾部，再进行调整 */
-	/* 性能较差，但便于实现吧 */
-	lept_pushback_array_element(v, e);
-
-	/* 当插入后元素数目为 1，不需要调整 */
-	if (v->u.a.size == 1)
-		return;
-
-	size_t i;
-	/* 调整位置 */
-	for (i = v->u.a.size - 1; i != index; i--)
-		lept_swap((v->u.a.e) + i - 1, (v->u.a.e) + i);
+	lept_value tmp;
+	assert(e != NULL);
+	/* e 可能是 v 的元素，先复制再留出位置，同 lept_pushback_array_element */
+	lept_value_init(&tmp);
+	lept_copy(&tmp, e);
+	memcpy(lept_emplace_array_element(v, index), &tmp, sizeof(lept_value));
 }
-void lept_erase_array_element(lept_value* v, size_t index, size_t count) {
-
-	assert(v != NULL && v->type == LEPT_ARRAY && index + count <= v->u.a.size);
-
-	/* 分配删除后数组大小两倍的空间，如果删除后 size 为 0 则分配一个空间 */
-	size_t new_size = v->u.a.size - count;
-	size_t new_capacity = 2 * new_size + 1;
-
-	size_t i;
-
-	/* 释放删除元素堆空间 */
-	for (i = index; i < index + count; i++)
-		lept_free(v->u.a.e + i);
+void lept_insert_array_element_move(lept_value* v, lept_value* e,
+                                    size_t index) {
+	lept_value tmp;
+	assert(e != NULL);
+	memcpy(&tmp, e, sizeof(lept_value));
+	lept_value_init(e);
+	memcpy(lept_emplace_array_element(v, index), &tmp, sizeof(lept_value));
+}
+lept_value* lept_emplace_array_element(lept_value* v, size_t index) {
+	lept_value* e;
+	assert(v != NULL && v->type == LEPT_ARRAY);
+	LEPT_LOAD(v);
+	e = lept_array_open(v, index, 1);
+	lept_value_init(e);
+	return e;
+}
+void lept_insert_array_range(lept_value* v, const lept_value* e, size_t count,
+                             size_t index) {
+	lept_value* p;
+	size_t i, self;
+	assert(v != NULL && v->type == LEPT_ARRAY && (e != NULL || count == 0));
+	LEPT_LOAD(v);
+	self = lept_array_offset(v, e, count);
+	p = lept_array_open(v, index, count);
+	for (i = 0; i < count; i++) {
+		lept_value_init(p + i);
+		lept_copy(p + i, self != LEPT_KEY_NOT_EXIST
+		                     ? lept_array_shifted(v, self + i, index, count)
+		                     : e + i);
+	}
+}
+void lept_insert_array_range_move(lept_value* v, lept_value* e, size_t count,
+                                  size_t index) {
+	lept_value* p;
+	lept_value* src;
+	size_t i, self;
+	assert(v != NULL && v->type == LEPT_ARRAY && (e != NULL || count == 0));
+	LEPT_LOAD(v);
+	self = lept_array_offset(v, e, count);
+	p = lept_array_open(v, index, count);
+
+	/* 按位逐个移入，来源置为 null */
+	for (i = 0; i < count; i++) {
+		src = self != LEPT_KEY_NOT_EXIST
+		          ? lept_array_shifted(v, self + i, index, count)
+		          : e + i;
+		memcpy(p + i, src, sizeof(lept_value));
+		lept_value_init(src);
+	}
+}
+void lept_erase_array_element(lept_value* v, size_t index, size_t count) {
+	size_t i, new_capacity;
+	lept_value* e;
 
-	/* 调整右侧区间值位置 */
-	/* 只需将右侧区间逐一移过来即可，无需考虑其他 */
-	for (i = index + count; i < v->u.a.size; i++)
-		memcpy((v->u.a.e) + i - count, (v->u.a.e) + i, sizeof(lept_value));
+	assert(v != NULL && v->type == LEPT_ARRAY);
+	LEPT_LOAD(v);
+	assert(index + count <= LEPT_NELEMS(v));
 
-	v->u.a.size = new_size;
+	/* 释放删除元素堆空间，右侧区间整体前移 */
+	if (count == 0)
+		return;
+	e = LEPT_ELEMS(v) + index;
+	for (i = 0; i < count; i++)
+		lept_free(e + i);
+	if (index + count < LEPT_NELEMS(v))
+		memmove(e, e + count,
+		        (LEPT_NELEMS(v) - index - count) * sizeof(lept_value));
+	LEPT_NELEMS(v) -= count;
 
 	/* 调整容量值 */
-	if (new_capacity < v->u.a.capacity) {
-		v->u.a.capacity = new_capacity;
-		v->u.a.e =
-		    (lept_value*)realloc(v->u.a.e, new_capacity * sizeof(lept_value));
+	new_capacity = lept_shrink_capacity(LEPT_ECAP(v), LEPT_NELEMS(v));
+	if (new_capacity < LEPT_ECAP(v)) {
+		LEPT_ELEMS(v) = (lept_value*)lept_realloc_storage(
+		    v, LEPT_ELEMS(v), LEPT_NELEMS(v) * sizeof(lept_value),
+		    new_capacity * sizeof(lept_value));
+		LEPT_SET_ECAP(v, new_capacity);
 	}
 }
 
 /* object */
 /* 必须初始化后才允许调用 */
-void lept_set_object(lept_value* v, size_t capacity) {
+int lept_set_object(lept_value* v, size_t capacity) {
 
 	assert(v != NULL);
+	if ((uint64_t)capacity > LEPT_LEN_MAX)
+		return LEPT_PARSE_TOO_LONG;
 	lept_free(v);
 
 	v->type = LEPT_OBJECT;
-	v->u.o.size = 0;
-	v->u.o.capacity = capacity;
-	v->u.o.m = capacity > 0
-	               ? (lept_member*)malloc(capacity * sizeof(lept_member))
-	               : NULL;
-	return;
+	LEPT_NMEMBERS(v) = 0;
+	LEPT_MEMBERS(v) =
+	    (lept_member*)lept_alloc_storage(NULL, lept_object_bytes(capacity));
+	LEPT_SET_MCAP(v, capacity);
+	lept_object_index_build(v);
+	return LEPT_PARSE_OK;
 }
 
 size_t lept_get_object_size(const lept_value* v) {
 	assert(v != NULL && v->type == LEPT_OBJECT);
-	return v->u.o.size;
+	LEPT_LOAD(v);
+	return LEPT_NMEMBERS(v);
 }
 size_t lept_get_object_capacity(const lept_value* v) {
 	assert(v != NULL && v->type == LEPT_OBJECT);
-	return v->u.o.capacity;
+	LEPT_LOAD(v);
+	return LEPT_MCAP(v);
 	return 0;
 }
 
-void lept_reserve_object(lept_value* v, size_t capacity) {
+int lept_reserve_object(lept_value* v, size_t capacity) {
 	assert(v != NULL && v->type == LEPT_OBJECT);
-	if (v->u.o.capacity < capacity) {
-		v->u.o.capacity = capacity;
-		v->u.o.m =
-		    (lept_member*)realloc(v->u.o.m, capacity * sizeof(lept_member));
-	}
+	if ((uint64_t)capacity > LEPT_LEN_MAX)
+		return LEPT_PARSE_TOO_LONG;
+	LEPT_LOAD(v);
+	if (LEPT_MCAP(v) < capacity)
+		lept_object_resize(v, capacity);
+	return LEPT_PARSE_OK;
 }
 
 void lept_shrink_object(lept_value* v) {
 	assert(v != NULL && v->type == LEPT_OBJECT);
-	if (v->u.o.capacity > v->u.o.size) {
-		v->u.o.capacity = v->u.o.size;
-		v->u.o.m = (lept_member*)realloc(v->u.o.m,
-		                                 v->u.o.capacity * sizeof(lept_member));
-	}
+	LEPT_LOAD(v);
+	if (LEPT_MCAP(v) > LEPT_NMEMBERS(v))
+		lept_object_resize(v, LEPT_NMEMBERS(v));
 }
 void lept_clear_object(lept_value* v) {
 	assert(v != NULL && v->type == LEPT_OBJECT);
-
-	/* 懒得去实现了，就逐个删了，可能对性能有影响  */
-	/* 每次均删除最后值，降低元素移动次数 */
+	LEPT_LOAD(v);
 
 	size_t i;
-	while (v->u.o.size != 0)
-		lept_remove_object_value_by_index(v, v->u.o.size - 1);
+	for (i = 0; i < LEPT_NMEMBERS(v); i++) {
+		if (!(v->flags & LEPT_FLAG_BORROWED_KEYS))
+			lept_mem_free(&lept_heap, LEPT_MEMBERS(v)[i].k);
+		lept_free(&LEPT_MEMBERS(v)[i].v);
+	}
+	LEPT_NMEMBERS(v) = 0;
+	lept_object_index_build(v);
 
 	/* clear 函数只清空，对于容量等不做处理 */
 	/* lept_shrink_object(v); */
@@ -508,20 +1461,23 @@ void lept_clear_object(lept_value* v) {
 
 const char* lept_get_object_key(const lept_value* v, size_t index) {
 	assert(v != NULL && v->type == LEPT_OBJECT);
-	assert(index < v->u.o.size);
-	return v->u.o.m[index].k;
+	LEPT_LOAD(v);
+	assert(index < LEPT_NMEMBERS(v));
+	return LEPT_MEMBERS(v)[index].k;
 }
 size_t lept_get_object_key_length(const lept_value* v, size_t index) {
 	assert(v != NULL && v->type == LEPT_OBJECT);
-	assert(index < v->u.o.size);
-	return v->u.o.m[index].klen;
+	LEPT_LOAD(v);
+	assert(index < LEPT_NMEMBERS(v));
+	return LEPT_MEMBERS(v)[index].klen;
 }
 
 const lept_value* lept_get_object_value_by_index(const lept_value* v,
                                                  size_t index) {
 	assert(v != NULL && v->type == LEPT_OBJECT);
-	assert(index < v->u.o.size);
-	return &v->u.o.m[index].v;
+	LEPT_LOAD(v);
+	assert(index < LEPT_NMEMBERS(v));
+	return &LEPT_MEMBERS(v)[index].v;
 }
 const lept_value* lept_get_object_value_by_key(const lept_value* v,
                                                const char* key, size_t klen) {
@@ -530,30 +1486,29 @@ const lept_value* lept_get_object_value_by_key(const lept_value* v,
 
 int lept_remove_object_value_by_index(lept_value* v, size_t index) {
 	assert(v != NULL && v->type == LEPT_OBJECT);
+	LEPT_LOAD(v);
 
-	if (index >= v->u.o.size)
+	if (index >= LEPT_NMEMBERS(v))
 		return OBJECT_INDEX_WRONG;
 
-	v->u.o.size--;
-	size_t new_capacity = 2 * v->u.o.size + 1;
+	lept_object_index_remove(v, index);
+	LEPT_NMEMBERS(v)--;
+	size_t new_capacity =
+	    lept_shrink_capacity(LEPT_MCAP(v), LEPT_NMEMBERS(v));
 
 	/* 当前位置元素空间释放 */
-	lept_member* ptr = v->u.o.m + index;
-	free_ptr(ptr->k);
+	lept_member* ptr = LEPT_MEMBERS(v) + index;
+	if (!(v->flags & LEPT_FLAG_BORROWED_KEYS))
+		lept_mem_free(&lept_heap, ptr->k);
 	lept_free(&(ptr->v));
 
-	/* 移动各元素值 */
-	size_t i;
-	for (i = index; i < v->u.o.size; i++) {
-		memcpy(v->u.o.m + i, v->u.o.m + i + 1, sizeof(lept_member));
-	}
+	/* 其后成员整体前移 */
+	memmove(ptr, ptr + 1,
+	        (LEPT_NMEMBERS(v) - index) * sizeof(lept_member));
 
 	/* 调整容量值 */
-	if (new_capacity < v->u.o.capacity) {
-		v->u.o.capacity = new_capacity;
-		v->u.o.m =
-		    (lept_member*)realloc(v->u.o.m, new_capacity * sizeof(lept_member));
-	}
+	if (new_capacity < LEPT_MCAP(v))
+		lept_object_resize(v, new_capacity);
 
 	return REMOVE_OBJECT_OK;
 }
@@ -571,54 +1526,86 @@ int lept_remove_object_value_by_key(lept_value* v, const char* key,
 int lept_set_object_value_by_index(lept_value* v, size_t index,
                                    const lept_value* s_v) {
 	assert(v != NULL && v->type == LEPT_OBJECT);
+	LEPT_LOAD(v);
+
+	if (index >= LEPT_NMEMBERS(v))
+		return OBJECT_INDEX_WRONG;
+
+	lept_copy(&((LEPT_MEMBERS(v) + index)->v), s_v);
+	return MODIFY_OBJECT_OK;
+}
+int lept_set_object_value_by_index_move(lept_value* v, size_t index,
+                                        lept_value* s_v) {
+	assert(v != NULL && v->type == LEPT_OBJECT);
+	LEPT_LOAD(v);
 
-	if (index >= v->u.o.size)
+	if (index >= LEPT_NMEMBERS(v))
 		return OBJECT_INDEX_WRONG;
 
-	lept_copy(&((v->u.o.m + index)->v), s_v);
+	lept_move(&((LEPT_MEMBERS(v) + index)->v), s_v);
 	return MODIFY_OBJECT_OK;
 }
 int lept_set_object_value_by_key(lept_value* v, const char* key, size_t klen,
                                  const lept_value* s_v) {
-	size_t index = lept_find_object_index(v, key, klen);
+	size_t index = lept_find_object_index(v, key, klen), self;
+	lept_member* m;
 
 	/* 当不存在时应该执行插入 */
 	if (index == LEPT_KEY_NOT_EXIST) {
+		/* s_v 可以是 v 的成员值，扩容后按下标重新定位 */
+		self = lept_object_offset(v, s_v);
+		m = lept_object_append(v, key, klen);
+		lept_copy(&m->v,
+		          self == LEPT_KEY_NOT_EXIST ? s_v : &LEPT_MEMBERS(v)[self].v);
+		return INSERT_OBJECT_OK;
+	}
 
-		/* 扩容 */
-		if (v->u.o.size == v->u.o.capacity)
-			lept_reserve_object(v,
-			                    v->u.o.capacity == 0 ? 1 : v->u.o.capacity * 2);
-
-		/* member 类型的复制 */
-
-		lept_member* ptr = (v->u.o.m) + v->u.o.size;
-
-		/* 此处必为未初始化 ptr->k，直接分配即可 */
-		ptr->k = (char*)malloc(klen + 1);
-
-		memcpy(ptr->k, key, klen);
-		ptr->k[klen] = '\0';
-		ptr->klen = klen;
-
-		/* copy 前执行 init */
-		lept_value_init(&(ptr->v));
-		lept_copy(&(ptr->v), s_v);
-		v->u.o.size++;
+	return lept_set_object_value_by_index(v, index, s_v);
+}
+int lept_set_object_value_by_key_move(lept_value* v, const char* key,
+                                      size_t klen, lept_value* s_v) {
+	size_t index = lept_find_object_index(v, key, klen), self;
+	lept_member* m;
 
+	if (index == LEPT_KEY_NOT_EXIST) {
+		self = lept_object_offset(v, s_v);
+		m = lept_object_append(v, key, klen);
+		lept_move(&m->v,
+		          self == LEPT_KEY_NOT_EXIST ? s_v : &LEPT_MEMBERS(v)[self].v);
 		return INSERT_OBJECT_OK;
 	}
 
-	return lept_set_object_value_by_index(v, index, s_v);
+	return lept_set_object_value_by_index_move(v, index, s_v);
+}
+lept_value* lept_emplace_object_value(lept_value* v, const char* key,
+                                      size_t klen) {
+	size_t index = lept_find_object_index(v, key, klen);
+	return index == LEPT_KEY_NOT_EXIST ? &lept_object_append(v, key, klen)->v
+	                                   : &LEPT_MEMBERS(v)[index].v;
 }
 
 size_t lept_find_object_index(const lept_value* v, const char* key,
                               size_t klen) {
 	assert(v != NULL && v->type == LEPT_OBJECT && key != NULL);
+	LEPT_LOAD(v);
 
 	size_t i;
-	for (i = 0; i < v->u.o.size; i++)
-		if (v->u.o.m[i].klen == klen && memcmp(v->u.o.m[i].k, key, klen) == 0)
+	const lept_member* m;
+	if (LEPT_MCAP(v) >= LEPT_OBJECT_INDEX_MIN) {
+		/* 散列索引查找，探测到空槽即不存在 */
+		size_t mask = lept_object_slots(LEPT_MCAP(v)) - 1;
+		const size_t* t = (const size_t*)(LEPT_MEMBERS(v) + LEPT_MCAP(v));
+		for (i = lept_hash_key(key, klen) & mask; t[i] != 0; i = (i + 1) & mask) {
+			m = &LEPT_MEMBERS(v)[t[i] - 1];
+			/* 取自同一键池的键只需比较指针 */
+			if (m->klen == klen && (m->k == key || memcmp(m->k, key, klen) == 0))
+				return t[i] - 1;
+		}
+		return LEPT_KEY_NOT_EXIST;
+	}
+
+	for (i = 0, m = LEPT_MEMBERS(v); i < LEPT_NMEMBERS(v); i++, m++)
+		if (m->klen == klen && (m->k == key || memcmp(m->k, key, klen) == 0))
 			return i;
 
 	return LEPT_KEY_NOT_EXIST;
@@ -626,20 +1613,46 @@ size_t lept_find_object_index(const lept_value* v, const char* key,
 const lept_value* lept_find_object_value(const lept_value* v, const char* key,
                                          size_t klen) {
 	size_t index = lept_find_object_index(v, key, klen);
-	return index != LEPT_KEY_NOT_EXIST ? &v->u.o.m[index].v : NULL;
+	return index != LEPT_KEY_NOT_EXIST ? &LEPT_MEMBERS(v)[index].v : NULL;
 }
 
 /*******************************/
 /* 此后为本文件处定义函数具体实现 */
 /*******************************/
 
-static void lept_context_free(lept_context* c) {
-	if (c != NULL && c->stack != NULL) {
-		free_ptr(c->stack);
-	}
+static void* lept_std_alloc(void* user, size_t size) {
+	(void)user;
+	return malloc(size);
+}
+
+static void* lept_std_realloc(void* user, void* p, size_t size) {
+	(void)user;
+	return realloc(p, size);
+}
+
+static void lept_std_free(void* user, void* p) {
+	(void)user;
+	free(p);
+}
+
+static void* lept_mem_alloc(const lept_allocator* a, size_t size) {
+	return a->alloc(a->user, size);
+}
+
+static void* lept_mem_realloc(const lept_allocator* a, void* p, size_t size) {
+	return a->realloc(a->user, p, size);
+}
+
+static void lept_mem_free(const lept_allocator* a, void* p) {
+	if (p != NULL)
+		a->free(a->user, p);
+}
 
+static void lept_context_free(lept_context* c) {
 	if (c != NULL) {
-		free_ptr(c);
+		lept_mem_free(c->alloc, c->stack);
+		lept_mem_free(c->alloc, c->frames);
+		lept_mem_free(c->alloc, c);
 	}
 }
 
@@ -653,7 +1666,7 @@ static void* lept_context_push(lept_context* c, size_t size) {
 			c->size = LEPT_PARSE_STACK_INIT_SIZE;
 		while (c->top + size >= c->size)
 			c->size += c->size >> 1;
-		c->stack = (char*)realloc(c->stack, c->size);
+		c->stack = (char*)lept_mem_realloc(c->alloc, c->stack, c->size);
 	}
 
 	ret = c->stack + c->top;
@@ -666,474 +1679,3024 @@ static void* lept_context_pop(lept_context* c, size_t size) {
 	return c->stack + (c->top -= size);
 }
 
-static void lept_parse_whitespace(lept_context* c) {
-	const char* p = c->json;
-	while (*p == ' ' || *p == '\t' || *p == '\r')
-		p++;
-	c->json = p;
+static lept_frame* lept_context_open(lept_context* c, lept_type type) {
+	lept_frame* f;
+	if (c->depth >= LEPT_PARSE_MAX_DEPTH)
+		return NULL;
+	if (c->depth == c->frames_size) {
+		c->frames_size = c->frames_size == 0 ? 16 : c->frames_size * 2;
+		c->frames = (lept_frame*)lept_mem_realloc(
+		    c->alloc, c->frames, c->frames_size * sizeof(lept_frame));
+	}
+	f = &c->frames[c->depth++];
+	f->type = type;
+	f->size = 0;
+	return f;
 }
 
-static int lept_parse_literal(lept_context* c, lept_value* v,
-                              const char* literal, lept_type type) {
-	size_t i;
-	EXPECT(c, literal[0]);
-
-	for (i = 0; literal[i + 1]; i++)
-		if (c->json[i] != literal[i + 1])
-			return LEPT_PARSE_INVALID_VALUE;
+static void* lept_context_alloc(lept_context* c, size_t size) {
+	return c->arena != NULL ? lept_arena_alloc(c->arena, size)
+	                        : lept_mem_alloc(&lept_heap, size);
+}
 
-	c->json += i;
-	v->type = type;
-	return LEPT_PARSE_OK;
+static char* lept_context_strdup(lept_context* c, const char* s, size_t len) {
+	char* ret = (char*)lept_context_alloc(c, len + 1);
+	if (len > 0)
+		memcpy(ret, s, len);
+	ret[len] = '\0';
+	return ret;
 }
 
-#if 0
-static int lept_parse_null(lept_context* c, lept_value* v) {
-	EXPECT(c, 'n');
-	if (c->json[0] != 'u' || c->json[1] != 'l' || c->json[2] != 'l')
-		return LEPT_PARSE_INVALID_VALUE;
+static lept_context* lept_context_new(const char* json, size_t len,
+                                      size_t padding) {
+	lept_context* c =
+	    (lept_context*)lept_mem_alloc(&lept_heap, sizeof(lept_context));
+	c->alloc = &lept_heap;
+	lept_context_reset(c, json, len, padding);
+	c->stack = NULL;
+	c->size = 0;
+	c->frames = NULL;
+	c->frames_size = 0;
+	return c;
+}
 
-	c->json += 3;
-	v->type = LEPT_NULL;
-	return LEPT_PARSE_OK;
+static void lept_context_reset(lept_context* c, const char* json, size_t len,
+                               size_t padding) {
+	c->json = json;
+	c->end = json + len;
+	c->limit = c->end + padding;
+	c->top = 0;
+	c->arena = NULL;
+	c->insitu = 0;
+	c->keys = NULL;
+	c->handler = &lept_dom_handler;
+	c->user = c;
+	c->depth = 0;
 }
 
-static int lept_parse_false(lept_context* c, lept_value* v) {
-	EXPECT(c, 'f');
-	if (c->json[0] != 'a' || c->json[1] != 'l' || c->json[2] != 's' ||
-	    c->json[3] != 'e')
-		return LEPT_PARSE_INVALID_VALUE;
+static lept_value* lept_dom_push(lept_context* c, lept_type type) {
+	lept_value* v = (lept_value*)lept_context_push(c, sizeof(lept_value));
+	v->type = type;
+	v->flags = 0;
+	return v;
+}
 
-	c->json += 4;
-	v->type = LEPT_FALSE;
-	return LEPT_PARSE_OK;
+static int lept_dom_null(void* user) {
+	lept_dom_push((lept_context*)user, LEPT_NULL);
+	return 0;
 }
 
-static int lept_parse_true(lept_context* c, lept_value* v) {
-	EXPECT(c, 't');
-	if (c->json[0] != 'r' || c->json[1] != 'u' || c->json[2] != 'e')
-		return LEPT_PARSE_INVALID_VALUE;
+static int lept_dom_bool(void* user, int b) {
+	lept_dom_push((lept_context*)user, b ? LEPT_TRUE : LEPT_FALSE);
+	return 0;
+}
 
-	c->json += 3;
-	v->type = LEPT_TRUE;
-	return LEPT_PARSE_OK;
+static int lept_dom_number(void* user, double n) {
+	lept_dom_push((lept_context*)user, LEPT_NUMBER)->u.n = n;
+	return 0;
 }
-#endif
 
-static int lept_parse_number(lept_context* c, lept_value* v) {
-	const char* p = c->json;
-	if (*p == '-')
-		p++;
-	if (*p == '0')
-		p++;
+static int lept_dom_string(void* user, const char* s, size_t len) {
+	lept_context* c = (lept_context*)user;
+	lept_value v;
+
+	/* s 位于刚出栈的空间，先在栈外构造值再入栈 */
+	/* 原地解析时 s 位于输入缓冲区中，直接引用 */
+	v.type = LEPT_STRING;
+	v.flags = 0;
+	if (!c->insitu && len <= LEPT_INLINE_MAX)
+		lept_string_inline(&v, s, len);
 	else {
-		if (!ISDIGIT1TO9(*p))
-			return LEPT_PARSE_INVALID_VALUE;
-		for (p++; ISDIGIT(*p); p++)
-			;
-	}
-	if (*p == '.') {
-		p++;
-		if (!ISDIGIT(*p))
-			return LEPT_PARSE_INVALID_VALUE;
-		for (p++; ISDIGIT(*p); p++)
-			;
+		LEPT_SPTR(&v) = c->insitu ? (char*)s : lept_context_strdup(c, s, len);
+		LEPT_SLEN(&v) = len;
+		v.flags = LEPT_CONTEXT_OWNS_STRINGS(c) ? 0 : LEPT_FLAG_BORROWED;
 	}
-	if (*p == 'E' || *p == 'e') {
-		p++;
-		if (*p == '+' || *p == '-')
-			p++;
-		if (!ISDIGIT(*p))
-			return LEPT_PARSE_INVALID_VALUE;
-		for (p++; ISDIGIT(*p); p++)
-			;
-	}
-
-	/* strtod endptr 指向转换后数字字符串后一个位置 */
-	errno = 0;
-	v->u.n = strtod(c->json, NULL);
-
-	/* 数字上界和下界 */
-	if (errno == ERANGE && (v->u.n == HUGE_VAL || v->u.n == -HUGE_VAL))
-		return LEPT_PARSE_NUMBER_TOO_BIG;
-
-	c->json = p;
-	v->type = LEPT_NUMBER;
-	return LEPT_PARSE_OK;
+	memcpy(lept_context_push(c, sizeof(lept_value)), &v, sizeof(lept_value));
+	return 0;
 }
 
-static const char* lept_parse_hex4(const char* p, unsigned* u) {
-	int i = 0;
-	*u = 0;
+static int lept_dom_key(void* user, const char* k, size_t klen) {
+	lept_context* c = (lept_context*)user;
+	char* str = c->keys != NULL ? (char*)lept_keypool_intern(c->keys, k, klen)
+	            : c->insitu     ? (char*)k
+	                            : lept_context_strdup(c, k, klen);
+	lept_value* v = lept_dom_push(c, LEPT_STRING);
+	LEPT_SPTR(v) = str;
+	LEPT_SLEN(v) = klen;
+	v->flags = LEPT_CONTEXT_OWNS_KEYS(c) ? 0 : LEPT_FLAG_BORROWED;
+	return 0;
+}
 
-	/* 4 位 16 进制数字 */
-	for (i = 0; i < 4; i++) {
-		char ch = *p++;
-		*u <<= 4;
+static int lept_dom_end_object(void* user, size_t size) {
+	lept_context* c = (lept_context*)user;
+	lept_value *e, *v;
+	lept_member* m;
+	size_t i;
 
-		/* 使用位操作求解 */
-		if (ch >= '0' && ch <= '9')
-			*u |= ch - '0';
-		else if (ch >= 'A' && ch <= 'F')
-			*u |= ch - ('A' - 10);
-		else if (ch >= 'a' && ch <= 'f')
-			*u |= ch - ('a' - 10);
-		else
-			return NULL;
+	/* 键与值成对出栈 */
+	e = (lept_value*)lept_context_pop(c, 2 * size * sizeof(lept_value));
+	m = (lept_member*)lept_alloc_storage(c, lept_object_bytes(size));
+	for (i = 0; i < size; i++) {
+		m[i].k = LEPT_SPTR(&e[2 * i]);
+		m[i].klen = LEPT_SLEN(&e[2 * i]);
+		memcpy(&m[i].v, &e[2 * i + 1], sizeof(lept_value));
 	}
 
-	return p;
+	/* 出栈的空间已复制，容器值在原处入栈 */
+	v = lept_dom_push(c, LEPT_OBJECT);
+	LEPT_MEMBERS(v) = m;
+	LEPT_NMEMBERS(v) = size;
+	LEPT_SET_MCAP(v, size);
+	v->flags = (c->arena != NULL ? LEPT_FLAG_BORROWED : 0) |
+	           (LEPT_CONTEXT_OWNS_KEYS(c) ? 0 : LEPT_FLAG_BORROWED_KEYS);
+	lept_object_index_build(v);
+	return 0;
 }
 
-static void lept_encode_utf8(lept_context* c, unsigned u) {
-	if (u <= 0x7F)
-		PUTC(c, u & 0xFF);
-	else if (u <= 0x7FF) {
-		PUTC(c, 0xC0 | ((u >> 6) & 0xFF));
-		PUTC(c, 0x80 | (u & 0x3F));
-	} else if (u <= 0xFFFF) {
-		PUTC(c, 0xE0 | ((u >> 12) & 0xFF));
-		PUTC(c, 0x80 | ((u >> 6) & 0x3F));
-		PUTC(c, 0x80 | (u & 0x3F));
-	} else {
-		assert(u <= 0x10FFFF);
-		PUTC(c, 0xF0 | ((u >> 18) & 0xFF));
-		PUTC(c, 0x80 | ((u >> 12) & 0x3F));
-		PUTC(c, 0x80 | ((u >> 6) & 0x3F));
-		PUTC(c, 0x80 | (u & 0x3F));
+static int lept_dom_end_array(void* user, size_t size) {
+	lept_context* c = (lept_context*)user;
+	size_t s = size * sizeof(lept_value);
+	lept_value *e = NULL, *v;
+	if (size > 0) {
+		e = (lept_value*)lept_alloc_storage(c, s);
+		memcpy(e, lept_context_pop(c, s), s);
 	}
+	v = lept_dom_push(c, LEPT_ARRAY);
+	LEPT_ELEMS(v) = e;
+	LEPT_NELEMS(v) = size;
+	LEPT_SET_ECAP(v, size);
+	v->flags = c->arena != NULL ? LEPT_FLAG_BORROWED : 0;
+	return 0;
 }
 
-static int lept_parse_string_raw(lept_context* c, char** str, size_t* len) {
-	size_t head = c->top;
-	unsigned u, u2;
-	const char* p;
-	EXPECT(c, '\"');
-	p = c->json;
-	for (;;) {
-		char ch = *p++;
-		switch (ch) {
-		case '\"':
-			*len = c->top - head;
-			*str = lept_context_pop(c, *len);
-			c->json = p;
-			return LEPT_PARSE_OK;
-		case '\\':
-			/* 转义字符处理 */
-			switch (*p++) {
-			case '\"':
-				PUTC(c, '\"');
-				break;
-			case '\\':
-				PUTC(c, '\\');
-				break;
-			case '/':
-				PUTC(c, '/');
-				break;
-			case 'b':
-				PUTC(c, '\b');
-				break;
-			case 'f':
-				PUTC(c, '\f');
-				break;
-			case 'n':
-				PUTC(c, '\n');
-				break;
-			case 'r':
-				PUTC(c, '\r');
-				break;
-			case 't':
-				PUTC(c, '\t');
-				break;
-			case 'u':
-				if (!(p = lept_parse_hex4(p, &u)))
-					STRING_ERROR(LEPT_PARSE_INVALID_UNICODE_HEX);
-				if (u >= 0xD800 && u <= 0xDBFF) {
-					if (*p++ != '\\')
-						STRING_ERROR(LEPT_PARSE_INVALID_UNICODE_SURROGATE);
-					if (*p++ != 'u')
-						STRING_ERROR(LEPT_PARSE_INVALID_UNICODE_SURROGATE);
-					if (!(p = lept_parse_hex4(p, &u2)))
-						STRING_ERROR(LEPT_PARSE_INVALID_UNICODE_HEX);
-					if (u2 < 0xDC00 || u2 > 0xDFFF)
-						STRING_ERROR(LEPT_PARSE_INVALID_UNICODE_SURROGATE);
-					u = (((u - 0xD800) << 10) | (u2 - 0xDC00)) + 0x10000;
-				}
-				lept_encode_utf8(c, u);
-				break;
-			default:
-				STRING_ERROR(LEPT_PARSE_INVALID_STRING_ESCAPE);
-			}
-			break;
-		case '\0':
-			STRING_ERROR(LEPT_PARSE_MISS_QUOTATION_MARK);
-		default:
-			/* 不合法字符处理 */
-			/* unescaped = %x20-21 / %x23-5B / %x5D-10FFFF */
-			if ((unsigned char)ch < 0x20)
-				STRING_ERROR(LEPT_PARSE_INVALID_STRING_CHAR);
+static void lept_string_inline(lept_value* v, const char* s, size_t len) {
+	assert(len <= LEPT_INLINE_MAX);
+	/* s 可能就是 v 的内容 */
+	if (len > 0)
+		memmove(v->u.i, s, len);
+	v->u.i[len] = '\0';
+	v->u.i[LEPT_INLINE_MAX] = (char)(LEPT_INLINE_MAX - len);
+	v->flags |= LEPT_FLAG_INLINE;
+}
 
-			PUTC(c, ch);
+static const char* lept_keypool_intern(lept_keypool* kp, const char* k,
+                                       size_t klen) {
+	size_t i, mask;
+	char* ret;
+
+	/* 装载率不超过 1/2，扩容时重新散列 */
+	if (2 * (kp->size + 1) > kp->capacity) {
+		size_t n = kp->capacity == 0 ? 64 : kp->capacity * 2;
+		lept_keypool_entry* slots = (lept_keypool_entry*)lept_mem_alloc(
+		    &lept_heap, n * sizeof(lept_keypool_entry));
+		memset(slots, 0, n * sizeof(lept_keypool_entry));
+		for (i = 0; i < kp->capacity; i++) {
+			size_t h;
+			if (kp->slots[i].k == NULL)
+				continue;
+			for (h = lept_hash_key(kp->slots[i].k, kp->slots[i].klen) & (n - 1);
+			     slots[h].k != NULL; h = (h + 1) & (n - 1))
+				;
+			slots[h] = kp->slots[i];
 		}
+		lept_mem_free(&lept_heap, kp->slots);
+		kp->slots = slots;
+		kp->capacity = n;
 	}
-}
 
-static int lept_parse_string(lept_context* c, lept_value* v) {
-	char* s;
-	size_t len;
-	int ret = lept_parse_string_raw(c, &s, &len);
-	if (ret == LEPT_PARSE_OK)
-		lept_set_string(v, s, len);
+	mask = kp->capacity - 1;
+	for (i = lept_hash_key(k, klen) & mask; kp->slots[i].k != NULL;
+	     i = (i + 1) & mask)
+		if (kp->slots[i].klen == klen && memcmp(kp->slots[i].k, k, klen) == 0)
+			return kp->slots[i].k;
+
+	ret = (char*)lept_arena_alloc(&kp->a, klen + 1);
+	memcpy(ret, k, klen);
+	ret[klen] = '\0';
+	kp->slots[i].k = ret;
+	kp->slots[i].klen = klen;
+	kp->size++;
 	return ret;
 }
 
-static int lept_parse_array(lept_context* c, lept_value* v) {
-	size_t i, size = 0;
+static void lept_dom_clear(lept_context* c) {
+	/* 字符串解码出错时已复原栈顶，栈中只有完整的值 */
+	while (c->top > 0)
+		lept_free((lept_value*)lept_context_pop(c, sizeof(lept_value)));
+}
+
+static int lept_parse_document(lept_context* c) {
 	int ret;
-	EXPECT(c, '[');
+	c->depth = 0;
 	lept_parse_whitespace(c);
+	ret = lept_parse_value(c);
 
-	/* 空类型数组解析 */
-	if (*c->json == ']') {
-		c->json++;
-		lept_set_array(v, 0);
-		return LEPT_PARSE_OK;
-	}
-
-	for (;;) {
-		lept_value e;
-		lept_value_init(&e);
-		ret = lept_parse_value(c, &e);
-		if (ret != LEPT_PARSE_OK)
-			break;
-
-		memcpy(lept_context_push(c, sizeof(lept_value)), &e,
-		       sizeof(lept_value));
-		size++;
+	/* 完成解析后处理，对 LEPT_PARSE_ROOT_NOT_SINGULAR 情况进行判断 */
+	if (ret == LEPT_PARSE_OK) {
 		lept_parse_whitespace(c);
-		if (*c->json == ',') {
-			c->json++;
-			lept_parse_whitespace(c);
-		} else if (*c->json == ']') {
-			c->json++;
-			lept_set_array(v, size);
-			memcpy(v->u.a.e, lept_context_pop(c, size * sizeof(lept_value)),
-			       size * sizeof(lept_value));
-			v->u.a.size = size;
-
-			return LEPT_PARSE_OK;
-		} else {
-			ret = LEPT_PARSE_MISS_COMMA_OR_SQUARE_BRACKET;
-			break;
-		}
+		if (c->json != c->end)
+			ret = LEPT_PARSE_ROOT_NOT_SINGULAR;
 	}
+	return ret;
+}
 
-	/* 此处释放栈空间主要目的在于对栈进行复原 */
-	for (i = 0; i < size; i++)
-		lept_free((lept_value*)lept_context_pop(c, sizeof(lept_value)));
+static int lept_parse_dom(lept_value* v, lept_context* c) {
+	int ret;
+	assert(v != NULL);
+	lept_value_init(v);
 
+	ret = lept_parse_document(c);
+	if (ret == LEPT_PARSE_OK)
+		memcpy(v, lept_context_pop(c, sizeof(lept_value)), sizeof(lept_value));
+	else
+		lept_dom_clear(c); /* 包括已完成但其后还有字符的根值 */
 	return ret;
 }
 
-static int lept_parse_object(lept_context* c, lept_value* v) {
-	size_t i, size;
-	lept_member m;
+static int lept_parse_root(lept_value* v, lept_context* c) {
+	int ret = lept_parse_dom(v, c);
+	lept_context_free(c);
+	return ret;
+}
 
+static int lept_parse_stream(lept_value* v, FILE* fp) {
+	char* buf = NULL;
+	size_t len = 0, cap = 0, n;
 	int ret;
-	EXPECT(c, '{');
-	lept_parse_whitespace(c);
-
-	/* 空对象处理 */
-	/* 可以考虑将空初始化抽象成函数 */
-	if (*c->json == '}') {
-		c->json++;
-		lept_set_object(v, 0);
-		return LEPT_PARSE_OK;
-	}
 
-	m.k = NULL;
-	size = 0;
-	for (;;) {
-		char* str;
-		lept_value_init(&m.v);
-
-		/* 解析 key */
-		if (*c->json != '"') {
-			ret = LEPT_PARSE_MISS_KEY;
-			break;
+	/* 按倍增方式读入，不依赖事先得知文件大小 */
+	do {
+		if (cap - len < LEPT_PARSE_STACK_INIT_SIZE) {
+			cap = cap == 0 ? 65536 : cap * 2;
+			buf = (char*)lept_mem_realloc(&lept_heap, buf, cap);
 		}
-		ret = lept_parse_string_raw(c, &str, &m.klen);
-		if (ret != LEPT_PARSE_OK)
-			break;
-
-		m.k = (char*)malloc(m.klen + 1);
+		n = fread(buf + len, 1, cap - len, fp);
+		len += n;
+	} while (n > 0);
 
-		memcpy(m.k, str, m.klen);
-		m.k[m.klen] = '\0';
+	if (ferror(fp)) {
+		lept_mem_free(&lept_heap, buf);
+		return LEPT_PARSE_FILE_ERROR;
+	}
 
-		/* 解析中间 : */
-		lept_parse_whitespace(c);
-		if (*c->json != ':') {
-			ret = LEPT_PARSE_MISS_COLON;
-			break;
-		}
-		c->json++;
-		lept_parse_whitespace(c);
+	/* 缓冲区剩余部分作为填充区 */
+	ret = lept_parse_root(v, lept_context_new(buf, len, cap - len));
+	lept_mem_free(&lept_heap, buf);
+	return ret;
+}
 
-		/* 解析对象值 */
-		ret = lept_parse_value(c, &m.v);
-		if (ret != LEPT_PARSE_OK)
-			break;
-		memcpy(lept_context_push(c, sizeof(lept_member)), &m,
-		       sizeof(lept_member));
-		size++;
-		m.k = NULL; /* ownership is transferred to member on stack */
+/* 出错时记录错误并丢弃未完成的值 */
+static int lept_push_fail(lept_push_parser* pp, int ret) {
+	lept_push_reset(pp);
+	pp->ret = ret;
+	return ret;
+}
 
-		/* parse ws [comma | right-curly-brace] ws */
-		lept_parse_whitespace(c);
-		if (*c->json == ',') {
-			c->json++;
-			lept_parse_whitespace(c);
-		} else if (*c->json == '}') {
-			size_t s = sizeof(lept_member) * size;
-			c->json++;
-			lept_set_object(v, size);
-			memcpy(v->u.o.m, lept_context_pop(c, sizeof(lept_member) * size),
-			       sizeof(lept_member) * size);
-			v->u.o.size = size;
-			return LEPT_PARSE_OK;
-		} else {
-			ret = LEPT_PARSE_MISS_COMMA_OR_CURLY_BRACKET;
-			break;
-		}
+/* 跨块的字符串或数值原文追加到 token */
+static void lept_push_token(lept_push_parser* pp, const char* p,
+                            const char* end) {
+	size_t len = (size_t)(end - p);
+	if (pp->token_len + len > pp->token_size) {
+		if (pp->token_size == 0)
+			pp->token_size = LEPT_PARSE_STACK_INIT_SIZE;
+		while (pp->token_len + len > pp->token_size)
+			pp->token_size += pp->token_size >> 1;
+		pp->token =
+		    (char*)lept_mem_realloc(pp->c.alloc, pp->token, pp->token_size);
 	}
-	/* Pop and free members on the stack */
-	free_ptr(m.k);
-	for (i = 0; i < size; i++) {
-		lept_member* m = (lept_member*)lept_context_pop(c, sizeof(lept_member));
-		free_ptr(m->k);
+	memcpy(pp->token + pp->token_len, p, len);
+	pp->token_len += len;
+}
 
-		lept_free(&m->v);
+/* 值已入栈，随后期待的内容由所在容器决定 */
+static void lept_push_value(lept_push_parser* pp) {
+	lept_frame* f;
+	if (pp->c.depth == 0) {
+		pp->state = LEPT_PUSH_END;
+		return;
 	}
-	v->type = LEPT_NULL;
-	return ret;
+	f = &pp->c.frames[pp->c.depth - 1];
+	f->size++;
+	pp->state =
+	    f->type == LEPT_ARRAY ? LEPT_PUSH_ARRAY_NEXT : LEPT_PUSH_OBJECT_NEXT;
 }
 
-static int lept_parse_value(lept_context* c, lept_value* v) {
-	switch (*c->json) {
-	case 'n':
-		return lept_parse_literal(c, v, "null", LEPT_NULL);
-	case 'f':
-		return lept_parse_literal(c, v, "false", LEPT_FALSE);
+/* 开始新的数组或对象 */
+static int lept_push_open(lept_push_parser* pp, lept_type type) {
+	if (lept_context_open(&pp->c, type) == NULL)
+		return LEPT_PARSE_TOO_DEEP;
+	pp->state =
+	    type == LEPT_ARRAY ? LEPT_PUSH_ARRAY_FIRST : LEPT_PUSH_OBJECT_FIRST;
+	return LEPT_PARSE_OK;
+}
+
+/* 闭合当前数组或对象，元素出栈装入容器 */
+static int lept_push_close(lept_push_parser* pp) {
+	lept_frame* f = &pp->c.frames[--pp->c.depth];
+	if (LEPT_LEN_OVERFLOW(&pp->c, f->size))
+		return LEPT_PARSE_TOO_LONG;
+	if (f->type == LEPT_ARRAY)
+		lept_dom_end_array(&pp->c, f->size);
+	else
+		lept_dom_end_object(&pp->c, f->size);
+	lept_push_value(pp);
+	return LEPT_PARSE_OK;
+}
+
+/* 解码完整的字符串原文 [p, end)，p 指向起始 '"' */
+static int lept_push_string(lept_push_parser* pp, const char* p,
+                            const char* end, int key) {
+	char* str;
+	size_t len;
+	int ret;
+	pp->c.json = p;
+	pp->c.end = pp->c.limit = end;
+	if ((ret = lept_parse_string_raw(&pp->c, &str, &len)) != LEPT_PARSE_OK)
+		return ret;
+	if (LEPT_LEN_OVERFLOW(&pp->c, len))
+		return LEPT_PARSE_TOO_LONG;
+	if (key) {
+		lept_dom_key(&pp->c, str, len);
+		pp->state = LEPT_PUSH_OBJECT_COLON;
+	} else {
+		lept_dom_string(&pp->c, str, len);
+		lept_push_value(pp);
+	}
+	return LEPT_PARSE_OK;
+}
+
+/* 解码 [p, end) 开头的数值，返回数值之后的位置，出错时返回 NULL */
+static const char* lept_push_number(lept_push_parser* pp, const char* p,
+                                    const char* end, int* ret) {
+	double n;
+	pp->c.json = p;
+	pp->c.end = pp->c.limit = end;
+	if ((*ret = lept_parse_number(&pp->c, &n)) != LEPT_PARSE_OK)
+		return NULL;
+	lept_dom_number(&pp->c, n);
+	lept_push_value(pp);
+	return pp->c.json;
+}
+
+/* 查找字符串原文的结束位置（结束的 '"' 或首个控制字符之后） */
+/* 到达 end 仍未结束时返回 NULL，转义状态记录在 pp->escaped */
+static const char* lept_push_scan_string(lept_push_parser* pp, const char* p,
+                                         const char* end) {
+	if (pp->escaped) {
+		if (p == end)
+			return NULL;
+		pp->escaped = 0;
+		p++;
+	}
+	for (;;) {
+		p = lept_scan_string(p, end, end);
+		if (p == end)
+			return NULL;
+		/* 控制字符使解码立即失败，无需继续等待 */
+		if (*p == '"' || (unsigned char)*p < 0x20)
+			return p + 1;
+		if (++p == end) {
+			pp->escaped = 1;
+			return NULL;
+		}
+		p++;
+	}
+}
+
+#define ISNUMBERCHAR(ch)                                                \
+	(ISDIGIT(ch) || (ch) == '-' || (ch) == '+' || (ch) == '.' || \
+	 (ch) == 'e' || (ch) == 'E')
+
+/* 数值之后的剩余字符不可能被当前状态接受，交给状态机得到对应错误 */
+static int lept_push_leftover(lept_push_parser* pp, const char* p,
+                              const char* end) {
+	char ch;
+	if (p == end)
+		return LEPT_PARSE_OK;
+	ch = *p;
+	return lept_push_run(pp, &ch, &ch + 1);
+}
+
+static int lept_push_run(lept_push_parser* pp, const char* p,
+                         const char* end) {
+	const char *q, *r;
+	int ret, key;
+	while (p < end) {
+		/* 跨块的字符串、数值和字面值 */
+		switch (pp->state) {
+		case LEPT_PUSH_STRING:
+		case LEPT_PUSH_KEY:
+			if ((q = lept_push_scan_string(pp, p, end)) == NULL) {
+				lept_push_token(pp, p, end);
+				return LEPT_PARSE_OK;
+			}
+			lept_push_token(pp, p, q);
+			p = q;
+			q = pp->token + pp->token_len;
+			pp->token_len = 0;
+			ret = lept_push_string(pp, pp->token, q, pp->state == LEPT_PUSH_KEY);
+			if (ret != LEPT_PARSE_OK)
+				return lept_push_fail(pp, ret);
+			continue;
+		case LEPT_PUSH_NUMBER:
+			for (q = p; q < end && ISNUMBERCHAR(*q); q++)
+				;
+			lept_push_token(pp, p, q);
+			if (q == end)
+				return LEPT_PARSE_OK;
+			p = q;
+			q = pp->token + pp->token_len;
+			pp->token_len = 0;
+			if ((r = lept_push_number(pp, pp->token, q, &ret)) == NULL)
+				return lept_push_fail(pp, ret);
+			if ((ret = lept_push_leftover(pp, r, q)) != LEPT_PARSE_OK)
+				return ret;
+			continue;
+		case LEPT_PUSH_LITERAL:
+			for (; p < end && *pp->literal != '\0'; p++, pp->literal++)
+				if (*p != *pp->literal)
+					return lept_push_fail(pp, LEPT_PARSE_INVALID_VALUE);
+			if (*pp->literal == '\0') {
+				lept_dom_push(&pp->c, pp->literal_type);
+				lept_push_value(pp);
+			}
+			continue;
+		default:
+			break;
+		}
+
+		/* 结构字符 */
+		p = lept_skip_whitespace(p, end, end);
+		if (p == end)
+			break;
+		key = 0;
+		switch (pp->state) {
+		case LEPT_PUSH_ARRAY_FIRST:
+			if (*p == ']') {
+				p++;
+				if ((ret = lept_push_close(pp)) != LEPT_PARSE_OK)
+					return lept_push_fail(pp, ret);
+				continue;
+			}
+			break;
+		case LEPT_PUSH_ARRAY_NEXT:
+			if (*p == ',') {
+				p++;
+				pp->state = LEPT_PUSH_VALUE;
+				continue;
+			}
+			if (*p == ']') {
+				p++;
+				if ((ret = lept_push_close(pp)) != LEPT_PARSE_OK)
+					return lept_push_fail(pp, ret);
+				continue;
+			}
+			return lept_push_fail(pp, LEPT_PARSE_MISS_COMMA_OR_SQUARE_BRACKET);
+		case LEPT_PUSH_OBJECT_FIRST:
+			if (*p == '}') {
+				p++;
+				if ((ret = lept_push_close(pp)) != LEPT_PARSE_OK)
+					return lept_push_fail(pp, ret);
+				continue;
+			}
+			/* fall through */
+		case LEPT_PUSH_OBJECT_KEY:
+			if (*p != '"')
+				return lept_push_fail(pp, LEPT_PARSE_MISS_KEY);
+			key = 1;
+			break;
+		case LEPT_PUSH_OBJECT_COLON:
+			if (*p != ':')
+				return lept_push_fail(pp, LEPT_PARSE_MISS_COLON);
+			p++;
+			pp->state = LEPT_PUSH_VALUE;
+			continue;
+		case LEPT_PUSH_OBJECT_NEXT:
+			if (*p == ',') {
+				p++;
+				pp->state = LEPT_PUSH_OBJECT_KEY;
+				continue;
+			}
+			if (*p == '}') {
+				p++;
+				if ((ret = lept_push_close(pp)) != LEPT_PARSE_OK)
+					return lept_push_fail(pp, ret);
+				continue;
+			}
+			return lept_push_fail(pp, LEPT_PARSE_MISS_COMMA_OR_CURLY_BRACKET);
+		case LEPT_PUSH_END:
+			return lept_push_fail(pp, LEPT_PARSE_ROOT_NOT_SINGULAR);
+		default:
+			break;
+		}
+
+		/* 值或键的开始，完整位于本块中的字符串和数值直接解码 */
+		switch (*p) {
+		case 'n':
+		case 'f':
+		case 't':
+			pp->literal = *p == 'n' ? "ull" : *p == 'f' ? "alse" : "rue";
+			pp->literal_type =
+			    *p == 'n' ? LEPT_NULL : *p == 'f' ? LEPT_FALSE : LEPT_TRUE;
+			pp->state = LEPT_PUSH_LITERAL;
+			p++;
+			break;
+		case '"':
+			pp->escaped = 0;
+			if ((q = lept_push_scan_string(pp, p + 1, end)) == NULL) {
+				pp->state = key ? LEPT_PUSH_KEY : LEPT_PUSH_STRING;
+				lept_push_token(pp, p, end);
+				return LEPT_PARSE_OK;
+			}
+			if ((ret = lept_push_string(pp, p, q, key)) != LEPT_PARSE_OK)
+				return lept_push_fail(pp, ret);
+			p = q;
+			break;
+		case '[':
+		case '{':
+			ret = lept_push_open(pp, *p == '[' ? LEPT_ARRAY : LEPT_OBJECT);
+			if (ret != LEPT_PARSE_OK)
+				return lept_push_fail(pp, ret);
+			p++;
+			break;
+		default:
+			for (q = p; q < end && ISNUMBERCHAR(*q); q++)
+				;
+			if (q == end) {
+				pp->state = LEPT_PUSH_NUMBER;
+				lept_push_token(pp, p, end);
+				return LEPT_PARSE_OK;
+			}
+			/* 数值之后的剩余输入照常由状态机处理 */
+			if ((p = lept_push_number(pp, p, end, &ret)) == NULL)
+				return lept_push_fail(pp, ret);
+			break;
+		}
+	}
+	return LEPT_PARSE_OK;
+}
+
+static int lept_push_eof(lept_push_parser* pp) {
+	const char *q, *end;
+	int ret;
+	switch (pp->state) {
+	case LEPT_PUSH_STRING:
+	case LEPT_PUSH_KEY:
+		/* 字符串未结束，解码给出与 lept_parse 相同的错误 */
+		ret = lept_push_string(pp, pp->token, pp->token + pp->token_len,
+		                       pp->state == LEPT_PUSH_KEY);
+		assert(ret != LEPT_PARSE_OK);
+		return lept_push_fail(pp, ret);
+	case LEPT_PUSH_NUMBER:
+		end = pp->token + pp->token_len;
+		pp->token_len = 0;
+		if ((q = lept_push_number(pp, pp->token, end, &ret)) == NULL)
+			return lept_push_fail(pp, ret);
+		if ((ret = lept_push_leftover(pp, q, end)) != LEPT_PARSE_OK)
+			return ret;
+		break;
+	case LEPT_PUSH_LITERAL:
+		return lept_push_fail(pp, LEPT_PARSE_INVALID_VALUE);
+	default:
+		break;
+	}
+
+	switch (pp->state) {
+	case LEPT_PUSH_VALUE:
+	case LEPT_PUSH_ARRAY_FIRST:
+		return lept_push_fail(pp, LEPT_PARSE_EXPECT_VALUE);
+	case LEPT_PUSH_ARRAY_NEXT:
+		return lept_push_fail(pp, LEPT_PARSE_MISS_COMMA_OR_SQUARE_BRACKET);
+	case LEPT_PUSH_OBJECT_FIRST:
+	case LEPT_PUSH_OBJECT_KEY:
+		return lept_push_fail(pp, LEPT_PARSE_MISS_KEY);
+	case LEPT_PUSH_OBJECT_COLON:
+		return lept_push_fail(pp, LEPT_PARSE_MISS_COLON);
+	case LEPT_PUSH_OBJECT_NEXT:
+		return lept_push_fail(pp, LEPT_PARSE_MISS_COMMA_OR_CURLY_BRACKET);
+	default:
+		return LEPT_PARSE_OK;
+	}
+}
+
+static void lept_push_reset(lept_push_parser* pp) {
+	lept_dom_clear(&pp->c);
+	pp->c.depth = 0;
+	pp->token_len = 0;
+	pp->escaped = 0;
+	pp->state = LEPT_PUSH_VALUE;
+	pp->ret = LEPT_PARSE_OK;
+}
+
+static void* lept_alloc_storage(lept_context* c, size_t size) {
+	char* ret;
+	if (size == 0)
+		return NULL;
+	size += LEPT_STORAGE_HEAD;
+	ret = (char*)(c != NULL ? lept_context_alloc(c, size)
+	                        : lept_mem_alloc(&lept_heap, size));
+	return ret + LEPT_STORAGE_HEAD;
+}
+
+static void* lept_realloc_storage(lept_value* v, void* p, size_t old_size,
+                                  size_t new_size) {
+	char* ret;
+	if (!(v->flags & LEPT_FLAG_BORROWED)) {
+		if (new_size == 0) {
+			lept_free_storage(p);
+			return NULL;
+		}
+		ret = (char*)lept_mem_realloc(
+		    &lept_heap, p != NULL ? (char*)p - LEPT_STORAGE_HEAD : NULL,
+		    new_size + LEPT_STORAGE_HEAD);
+		return ret + LEPT_STORAGE_HEAD;
+	}
+
+	/* 写时复制，此后存储归该值所有 */
+	ret = (char*)lept_alloc_storage(NULL, new_size);
+	if (old_size > new_size)
+		old_size = new_size;
+	if (old_size > 0)
+		memcpy(ret, p, old_size);
+	v->flags &= ~LEPT_FLAG_BORROWED;
+	return ret;
+}
+
+static void lept_free_storage(void* p) {
+	if (p != NULL)
+		lept_mem_free(&lept_heap, (char*)p - LEPT_STORAGE_HEAD);
+}
+
+static void lept_own_object_keys(lept_value* v) {
+	size_t i;
+	if (!(v->flags & LEPT_FLAG_BORROWED_KEYS))
+		return;
+	for (i = 0; i < LEPT_NMEMBERS(v); i++) {
+		char* k = (char*)lept_mem_alloc(&lept_heap,
+		                                LEPT_MEMBERS(v)[i].klen + 1);
+		memcpy(k, LEPT_MEMBERS(v)[i].k, LEPT_MEMBERS(v)[i].klen + 1);
+		LEPT_MEMBERS(v)[i].k = k;
+	}
+	v->flags &= ~LEPT_FLAG_BORROWED_KEYS;
+}
+
+static uint64_t lept_hash_mix(uint64_t h) {
+	h ^= h >> 30;
+	h *= 0xBF58476D1CE4E5B9ULL;
+	h ^= h >> 27;
+	h *= 0x94D049BB133111EBULL;
+	return h ^ (h >> 31);
+}
+
+static uint64_t lept_hash_value(const lept_value* v) {
+	uint64_t h = (uint64_t)v->type, bits;
+	double n;
+	size_t i;
+	LEPT_LOAD(v);
+	switch (v->type) {
+	case LEPT_STRING:
+		h ^= (uint64_t)lept_hash_key(LEPT_STR(v), LEPT_STRLEN(v)) << 8;
+		break;
+	case LEPT_NUMBER:
+		/* -0 与 0 相等，散列值也须相同 */
+		n = v->u.n == 0.0 ? 0.0 : v->u.n;
+		memcpy(&bits, &n, sizeof(bits));
+		h ^= bits;
+		break;
+	case LEPT_ARRAY:
+		for (i = 0; i < LEPT_NELEMS(v); i++)
+			h = lept_hash_mix(h ^ lept_hash_value(&LEPT_ELEMS(v)[i]));
+		break;
+	case LEPT_OBJECT:
+		/* 各成员的散列相加，与成员顺序无关 */
+		for (i = 0; i < LEPT_NMEMBERS(v); i++)
+			h += lept_hash_mix(
+			    (uint64_t)lept_hash_key(LEPT_MEMBERS(v)[i].k,
+			                            LEPT_MEMBERS(v)[i].klen) ^
+			    lept_hash_mix(lept_hash_value(&LEPT_MEMBERS(v)[i].v)));
+		h ^= (uint64_t)LEPT_NMEMBERS(v) << 8;
+		break;
+	default:
+		break;
+	}
+	return lept_hash_mix(h);
+}
+
+static int lept_is_equal_shallow(const lept_value* lhs,
+                                 const lept_value* rhs) {
+	if (lhs->type != rhs->type)
+		return 0;
+	/* 同一段原文无需解码 */
+	if ((lhs->flags & rhs->flags & LEPT_FLAG_LAZY) &&
+	    LEPT_LJSON(lhs) == LEPT_LJSON(rhs) && LEPT_LLEN(lhs) == LEPT_LLEN(rhs))
+		return 1;
+	switch (lhs->type) {
+	case LEPT_STRING:
+		LEPT_LOAD(lhs);
+		LEPT_LOAD(rhs);
+		return LEPT_STRLEN(lhs) == LEPT_STRLEN(rhs) &&
+		       memcmp(LEPT_STR(lhs), LEPT_STR(rhs), LEPT_STRLEN(lhs)) == 0;
+	case LEPT_NUMBER:
+		return lhs->u.n == rhs->u.n;
+	case LEPT_ARRAY:
+		LEPT_LOAD(lhs);
+		LEPT_LOAD(rhs);
+		return LEPT_NELEMS(lhs) == LEPT_NELEMS(rhs);
+	case LEPT_OBJECT:
+		LEPT_LOAD(lhs);
+		LEPT_LOAD(rhs);
+		return LEPT_NMEMBERS(lhs) == LEPT_NMEMBERS(rhs);
+	default:
+		return 1;
+	}
+}
+
+static size_t lept_match_member(const lept_value* lhs, const lept_value* rhs,
+                                size_t i) {
+	const lept_member* l = &LEPT_MEMBERS(lhs)[i];
+	const lept_member* r = &LEPT_MEMBERS(rhs)[i];
+	if (l->klen == r->klen && memcmp(l->k, r->k, l->klen) == 0)
+		return i;
+	return lept_find_object_index(rhs, l->k, l->klen);
+}
+
+/* FNV-1a */
+static size_t lept_hash_key(const char* k, size_t klen) {
+	size_t i, h = (size_t)2166136261UL;
+	for (i = 0; i < klen; i++)
+		h = (h ^ (unsigned char)k[i]) * 16777619UL;
+	return h;
+}
+
+/* 散列表槽数，不小于两倍容量的 2 的幂，装载率不超过 1/2 */
+static size_t lept_object_slots(size_t capacity) {
+	size_t n = LEPT_OBJECT_INDEX_MIN;
+	while (n < 2 * capacity)
+		n <<= 1;
+	return n;
+}
+
+static size_t lept_object_bytes(size_t capacity) {
+	size_t bytes = capacity * sizeof(lept_member);
+	if (capacity >= LEPT_OBJECT_INDEX_MIN)
+		bytes += lept_object_slots(capacity) * sizeof(size_t);
+	return bytes;
+}
+
+static size_t lept_grow_capacity(size_t capacity, size_t size) {
+	assert((uint64_t)size <= LEPT_LEN_MAX);
+	capacity = capacity == 0 ? 1 : capacity * 2;
+	/* 倍增不越过长度上限，以免 lept_reserve_* 失败 */
+	if ((uint64_t)capacity > LEPT_LEN_MAX)
+		capacity = LEPT_LEN_MAX;
+	return capacity < size ? size : capacity;
+}
+
+static size_t lept_shrink_capacity(size_t capacity, size_t size) {
+	return size <= capacity / 4 ? 2 * size : capacity;
+}
+
+static lept_value* lept_array_open(lept_value* v, size_t index,
+                                   size_t count) {
+	lept_value* e;
+	assert(index <= LEPT_NELEMS(v));
+	if (count == 0)
+		return NULL;
+	if (LEPT_ECAP(v) - LEPT_NELEMS(v) < count)
+		lept_reserve_array(
+		    v, lept_grow_capacity(LEPT_ECAP(v), LEPT_NELEMS(v) + count));
+	e = LEPT_ELEMS(v) + index;
+	if (index < LEPT_NELEMS(v))
+		memmove(e + count, e, (LEPT_NELEMS(v) - index) * sizeof(lept_value));
+	LEPT_NELEMS(v) += count;
+	return e;
+}
+
+static size_t lept_array_offset(const lept_value* v, const lept_value* e,
+                                size_t count) {
+	const lept_value* elems = LEPT_ELEMS(v);
+	if (count == 0 || elems == NULL || e < elems ||
+	    e >= elems + LEPT_NELEMS(v))
+		return LEPT_KEY_NOT_EXIST;
+	assert((size_t)(e - elems) + count <= LEPT_NELEMS(v));
+	return (size_t)(e - elems);
+}
+
+static lept_value* lept_array_shifted(lept_value* v, size_t i, size_t index,
+                                      size_t count) {
+	return LEPT_ELEMS(v) + (i < index ? i : i + count);
+}
+
+static void lept_object_resize(lept_value* v, size_t capacity) {
+	/* 只需保留成员，索引按新容量重建 */
+	LEPT_MEMBERS(v) = (lept_member*)lept_realloc_storage(
+	    v, LEPT_MEMBERS(v), LEPT_NMEMBERS(v) * sizeof(lept_member),
+	    lept_object_bytes(capacity));
+	LEPT_SET_MCAP(v, capacity);
+	lept_object_index_build(v);
+}
+
+static void* lept_copy_alloc(char** pool, size_t size) {
+	char* ret;
+	if (pool == NULL)
+		return lept_mem_alloc(&lept_heap, size);
+	ret = *pool;
+	*pool += LEPT_ARENA_ROUND(size);
+	return ret;
+}
+
+static size_t lept_copy_bytes(const lept_value* src) {
+	size_t i, size = 0;
+	/* 池中副本须先得到解码后的大小，只能就地解码 src */
+	LEPT_LOAD(src);
+	if (src->flags & LEPT_FLAG_INLINE)
+		return 0;
+	switch (src->type) {
+	case LEPT_STRING:
+		return LEPT_SLEN(src) > LEPT_INLINE_MAX
+		           ? LEPT_ARENA_ROUND(LEPT_SLEN(src) + 1)
+		           : 0;
+	case LEPT_ARRAY:
+		if (LEPT_ECAP(src) > 0)
+			size = LEPT_ARENA_ROUND(LEPT_STORAGE_HEAD +
+			                        LEPT_ECAP(src) * sizeof(lept_value));
+		for (i = 0; i < LEPT_NELEMS(src); i++)
+			size += lept_copy_bytes(&LEPT_ELEMS(src)[i]);
+		return size;
+	case LEPT_OBJECT:
+		if (LEPT_MCAP(src) > 0)
+			size = LEPT_ARENA_ROUND(LEPT_STORAGE_HEAD +
+			                        lept_object_bytes(LEPT_MCAP(src)));
+		for (i = 0; i < LEPT_NMEMBERS(src); i++)
+			size += LEPT_ARENA_ROUND(LEPT_MEMBERS(src)[i].klen + 1) +
+			        lept_copy_bytes(&LEPT_MEMBERS(src)[i].v);
+		return size;
+	default:
+		return 0;
+	}
+}
+
+static void lept_copy_value(lept_value* dst, const lept_value* src,
+                            char** pool) {
+	const unsigned borrowed = pool != NULL ? LEPT_FLAG_BORROWED : 0;
+	size_t i, n;
+	char* p;
+
+	/* 值内字符串与标量整体复制 */
+	memcpy(dst, src, sizeof(lept_value));
+	if (src->flags & LEPT_FLAG_INLINE)
+		return;
+	/* 未解码的值在副本上解码，副本不引用原文，src 保持未解码 */
+	if (src->flags & LEPT_FLAG_LAZY) {
+		assert(pool == NULL);
+		lept_load(dst);
+		return;
+	}
+	dst->flags = 0;
+	switch (src->type) {
+	case LEPT_STRING:
+		if ((n = LEPT_SLEN(src)) <= LEPT_INLINE_MAX) {
+			lept_string_inline(dst, LEPT_SPTR(src), n);
+			return;
+		}
+		LEPT_SPTR(dst) = (char*)lept_copy_alloc(pool, n + 1);
+		memcpy(LEPT_SPTR(dst), LEPT_SPTR(src), n + 1);
+		dst->flags = borrowed;
+		break;
+	case LEPT_ARRAY:
+		n = LEPT_ECAP(src);
+		if (n > 0) {
+			p = (char*)lept_copy_alloc(pool, LEPT_STORAGE_HEAD +
+			                                     n * sizeof(lept_value));
+			LEPT_ELEMS(dst) = (lept_value*)(void*)(p + LEPT_STORAGE_HEAD);
+			LEPT_SET_ECAP(dst, n);
+		} else
+			LEPT_ELEMS(dst) = NULL;
+		for (i = 0; i < LEPT_NELEMS(src); i++)
+			lept_copy_value(&LEPT_ELEMS(dst)[i], &LEPT_ELEMS(src)[i], pool);
+		dst->flags = borrowed;
+		break;
+	case LEPT_OBJECT:
+		/* 容量相同，散列索引中的成员下标可直接复制 */
+		n = LEPT_MCAP(src);
+		if (n > 0) {
+			p = (char*)lept_copy_alloc(pool, LEPT_STORAGE_HEAD +
+			                                     lept_object_bytes(n));
+			LEPT_MEMBERS(dst) = (lept_member*)(void*)(p + LEPT_STORAGE_HEAD);
+			LEPT_SET_MCAP(dst, n);
+			if (n >= LEPT_OBJECT_INDEX_MIN)
+				memcpy(LEPT_MEMBERS(dst) + n, LEPT_MEMBERS(src) + n,
+				       lept_object_slots(n) * sizeof(size_t));
+		} else
+			LEPT_MEMBERS(dst) = NULL;
+		for (i = 0; i < LEPT_NMEMBERS(src); i++) {
+			const lept_member* m = &LEPT_MEMBERS(src)[i];
+			LEPT_MEMBERS(dst)[i].k = (char*)lept_copy_alloc(pool, m->klen + 1);
+			memcpy(LEPT_MEMBERS(dst)[i].k, m->k, m->klen + 1);
+			LEPT_MEMBERS(dst)[i].klen = m->klen;
+			lept_copy_value(&LEPT_MEMBERS(dst)[i].v, &m->v, pool);
+		}
+		dst->flags = pool != NULL ? borrowed | LEPT_FLAG_BORROWED_KEYS : 0;
+		break;
+	default:
+		break;
+	}
+}
+
+static lept_member* lept_object_append(lept_value* v, const char* key,
+                                       size_t klen) {
+	lept_member* m;
+	char* k;
+
+	/* key 可能是某个成员值中的值内字符串，扩容前先复制 */
+	k = (char*)lept_mem_alloc(&lept_heap, klen + 1);
+	if (klen > 0)
+		memcpy(k, key, klen);
+	k[klen] = '\0';
+
+	/* 新键由堆分配，已有键须同样归该对象所有 */
+	lept_own_object_keys(v);
+
+	/* 扩容 */
+	if (LEPT_NMEMBERS(v) == LEPT_MCAP(v))
+		lept_reserve_object(
+		    v, lept_grow_capacity(LEPT_MCAP(v), LEPT_NMEMBERS(v) + 1));
+
+	m = LEPT_MEMBERS(v) + LEPT_NMEMBERS(v);
+	m->k = k;
+	m->klen = klen;
+	lept_value_init(&m->v);
+	lept_object_index_insert(v, LEPT_NMEMBERS(v)++);
+	return m;
+}
+
+static size_t lept_object_offset(const lept_value* v, const lept_value* e) {
+	const lept_member* m = LEPT_MEMBERS(v);
+	size_t i;
+	if (m == NULL || (const char*)e < (const char*)m ||
+	    (const char*)e >= (const char*)(m + LEPT_NMEMBERS(v)))
+		return LEPT_KEY_NOT_EXIST;
+	i = (size_t)((const char*)e - (const char*)m) / sizeof(lept_member);
+	assert(e == &m[i].v);
+	return i;
+}
+
+static void lept_object_index_build(lept_value* v) {
+	size_t i;
+	if (LEPT_MCAP(v) < LEPT_OBJECT_INDEX_MIN)
+		return;
+	memset(LEPT_MEMBERS(v) + LEPT_MCAP(v), 0,
+	       lept_object_slots(LEPT_MCAP(v)) * sizeof(size_t));
+	for (i = 0; i < LEPT_NMEMBERS(v); i++)
+		lept_object_index_insert(v, i);
+}
+
+static void lept_object_index_insert(lept_value* v, size_t i) {
+	size_t mask, h;
+	size_t* t;
+	lept_member* m;
+	if (LEPT_MCAP(v) < LEPT_OBJECT_INDEX_MIN)
+		return;
+	mask = lept_object_slots(LEPT_MCAP(v)) - 1;
+	m = LEPT_MEMBERS(v);
+	t = (size_t*)(m + LEPT_MCAP(v));
+	for (h = lept_hash_key(m[i].k, m[i].klen) & mask; t[h] != 0;
+	     h = (h + 1) & mask)
+		;
+	t[h] = i + 1;
+}
+
+static void lept_object_index_remove(lept_value* v, size_t i) {
+	size_t mask, n, h, j, k;
+	size_t* t;
+	lept_member* m;
+	if (LEPT_MCAP(v) < LEPT_OBJECT_INDEX_MIN)
+		return;
+	n = lept_object_slots(LEPT_MCAP(v));
+	mask = n - 1;
+	m = LEPT_MEMBERS(v);
+	t = (size_t*)(m + LEPT_MCAP(v));
+	for (h = lept_hash_key(m[i].k, m[i].klen) & mask;
+	     t[h] != i + 1; h = (h + 1) & mask)
+		;
+
+	/* 后移删除：探测链中其后的项若可填入空槽则前移，保持探测链连续 */
+	for (j = h;;) {
+		j = (j + 1) & mask;
+		if (t[j] == 0)
+			break;
+		k = lept_hash_key(m[t[j] - 1].k, m[t[j] - 1].klen) & mask;
+		/* k 不在循环区间 (h, j] 内时，j 处的项可移至 h */
+		if (h <= j ? (k <= h || k > j) : (k <= h && k > j)) {
+			t[h] = t[j];
+			h = j;
+		}
+	}
+	t[h] = 0;
+
+	/* 其后成员将前移一位 */
+	if (i + 1 < LEPT_NMEMBERS(v))
+		for (j = 0; j < n; j++)
+			if (t[j] > i + 1)
+				t[j]--;
+}
+
+static const char* lept_lazy_skip(const char* p, const char* end) {
+	size_t depth = 0;
+	do {
+		switch (*p++) {
+		case '"':
+			/* 原文已校验，字符串中只会遇到 '\\' 与结束的 '"' */
+			for (;;) {
+				p = lept_scan_string(p, end, end);
+				if (*p++ == '"')
+					break;
+				p++;
+			}
+			break;
+		case '[':
+		case '{':
+			depth++;
+			break;
+		case ']':
+		case '}':
+			depth--;
+			break;
+		default:
+			break;
+		}
+	} while (depth > 0);
+	return p;
+}
+
+static void lept_lazy_value(lept_context* c, lept_value* v) {
+	const char* p = c->json;
+	double n;
+	v->flags = 0;
+	switch (*p) {
+	case 'n':
+		c->json += 4;
+		v->type = LEPT_NULL;
+		break;
+	case 't':
+		c->json += 4;
+		v->type = LEPT_TRUE;
+		break;
+	case 'f':
+		c->json += 5;
+		v->type = LEPT_FALSE;
+		break;
+	case '"':
+	case '[':
+	case '{':
+		c->json = lept_lazy_skip(p, c->end);
+		LEPT_LJSON(v) = p;
+		LEPT_LLEN(v) = (size_t)(c->json - p);
+		v->type = *p == '"' ? LEPT_STRING : *p == '[' ? LEPT_ARRAY : LEPT_OBJECT;
+		v->flags = LEPT_FLAG_LAZY;
+		break;
+	default:
+		/* 数值解码不分配空间，直接完成 */
+		lept_parse_number(c, &n);
+		v->u.n = n;
+		v->type = LEPT_NUMBER;
+		break;
+	}
+}
+
+static void lept_lazy_load(lept_value* v) {
+	lept_context c;
+	size_t size = 0;
+	char* s;
+	size_t len;
+
+	/* 元素与成员经解析栈装入，方式同 DOM 构造 */
+	c.json = LEPT_LJSON(v);
+	c.end = c.limit = LEPT_LJSON(v) + LEPT_LLEN(v);
+	c.stack = NULL;
+	c.size = c.top = 0;
+	c.arena = NULL;
+	c.insitu = 0;
+	c.keys = NULL;
+	c.handler = &lept_dom_handler;
+	c.user = &c;
+	c.frames = NULL;
+	c.depth = c.frames_size = 0;
+	c.alloc = &lept_heap;
+
+	if (v->type == LEPT_STRING) {
+		lept_parse_string_raw(&c, &s, &len);
+		lept_dom_string(&c, s, len);
+	} else {
+		char close = v->type == LEPT_ARRAY ? ']' : '}';
+		c.json++;
+		lept_parse_whitespace(&c);
+		while (*c.json != close) {
+			if (v->type == LEPT_OBJECT) {
+				lept_parse_string_raw(&c, &s, &len);
+				lept_dom_key(&c, s, len);
+				lept_parse_whitespace(&c);
+				c.json++; /* ':' */
+				lept_parse_whitespace(&c);
+			}
+			lept_lazy_value(
+			    &c, (lept_value*)lept_context_push(&c, sizeof(lept_value)));
+			size++;
+			lept_parse_whitespace(&c);
+			if (*c.json == ',') {
+				c.json++;
+				lept_parse_whitespace(&c);
+			}
+		}
+		if (v->type == LEPT_ARRAY)
+			lept_dom_end_array(&c, size);
+		else
+			lept_dom_end_object(&c, size);
+	}
+
+	memcpy(v, lept_context_pop(&c, sizeof(lept_value)), sizeof(lept_value));
+	lept_mem_free(c.alloc, c.stack);
+}
+
+/* 计算掩码中最低位 1 的位置 */
+#if defined(__GNUC__) || defined(__clang__)
+#define LEPT_CTZ(x) __builtin_ctz(x)
+#else
+static int LEPT_CTZ(unsigned x) {
+	int n = 0;
+	while (!(x & 1)) {
+		x >>= 1;
+		n++;
+	}
+	return n;
+}
+#endif
+
+/* 所有整块读取都不越过 lim，[end, lim) 为调用者保证可读的填充区 */
+/* 找到的位置落在 end 之后时视为输入结束 */
+static const char* lept_scan_string(const char* p, const char* end,
+                                    const char* lim) {
+#if defined(__AVX2__)
+	const __m256i quote = _mm256_set1_epi8('"');
+	const __m256i escape = _mm256_set1_epi8('\\');
+	const __m256i ctrl = _mm256_set1_epi8(0x1F);
+	for (; p < end && lim - p >= 32; p += 32) {
+		__m256i x = _mm256_loadu_si256((const __m256i*)p);
+		__m256i t = _mm256_or_si256(
+		    _mm256_or_si256(_mm256_cmpeq_epi8(x, quote),
+		                    _mm256_cmpeq_epi8(x, escape)),
+		    _mm256_cmpeq_epi8(_mm256_min_epu8(x, ctrl), x));
+		unsigned mask = (unsigned)_mm256_movemask_epi8(t);
+		if (mask != 0) {
+			p += LEPT_CTZ(mask);
+			return p < end ? p : end;
+		}
+	}
+#elif defined(__SSE2__)
+	const __m128i quote = _mm_set1_epi8('"');
+	const __m128i escape = _mm_set1_epi8('\\');
+	const __m128i ctrl = _mm_set1_epi8(0x1F);
+	for (; p < end && lim - p >= 16; p += 16) {
+		__m128i x = _mm_loadu_si128((const __m128i*)p);
+		__m128i t = _mm_or_si128(
+		    _mm_or_si128(_mm_cmpeq_epi8(x, quote), _mm_cmpeq_epi8(x, escape)),
+		    _mm_cmpeq_epi8(_mm_min_epu8(x, ctrl), x));
+		unsigned mask = (unsigned)_mm_movemask_epi8(t);
+		if (mask != 0) {
+			p += LEPT_CTZ(mask);
+			return p < end ? p : end;
+		}
+	}
+#else
+	/* SWAR：一次检查一个机器字，含特殊字符时再逐字节定位 */
+	const size_t ones = (size_t)-1 / 255;
+	const size_t highs = ones * 0x80;
+	for (; p < end && (size_t)(lim - p) >= sizeof(size_t);
+	     p += sizeof(size_t)) {
+		size_t x, q, e;
+		memcpy(&x, p, sizeof(x));
+		q = x ^ (ones * '"');
+		e = x ^ (ones * '\\');
+		if ((((q - ones) & ~q) | ((e - ones) & ~e) | ((x - ones * 0x20) & ~x)) &
+		    highs)
+			break;
+	}
+#endif
+	for (; p < end; p++)
+		if (*p == '"' || *p == '\\' || (unsigned char)*p < 0x20)
+			return p;
+	return end;
+}
+
+#define ISWHITESPACE(ch) \
+	((ch) == ' ' || (ch) == '\t' || (ch) == '\n' || (ch) == '\r')
+
+/* 跳过连续空白，返回第一个非空白字符位置，读取范围同 lept_scan_string */
+static const char* lept_skip_whitespace(const char* p, const char* end,
+                                        const char* lim) {
+#if defined(__AVX2__)
+	const __m256i space = _mm256_set1_epi8(' ');
+	const __m256i tab = _mm256_set1_epi8('\t');
+	const __m256i lf = _mm256_set1_epi8('\n');
+	const __m256i cr = _mm256_set1_epi8('\r');
+	for (; p < end && lim - p >= 32; p += 32) {
+		__m256i x = _mm256_loadu_si256((const __m256i*)p);
+		__m256i t = _mm256_or_si256(
+		    _mm256_or_si256(_mm256_cmpeq_epi8(x, space),
+		                    _mm256_cmpeq_epi8(x, tab)),
+		    _mm256_or_si256(_mm256_cmpeq_epi8(x, lf),
+		                    _mm256_cmpeq_epi8(x, cr)));
+		unsigned mask = ~(unsigned)_mm256_movemask_epi8(t);
+		if (mask != 0) {
+			p += LEPT_CTZ(mask);
+			return p < end ? p : end;
+		}
+	}
+#elif defined(__SSE2__)
+	const __m128i space = _mm_set1_epi8(' ');
+	const __m128i tab = _mm_set1_epi8('\t');
+	const __m128i lf = _mm_set1_epi8('\n');
+	const __m128i cr = _mm_set1_epi8('\r');
+	for (; p < end && lim - p >= 16; p += 16) {
+		__m128i x = _mm_loadu_si128((const __m128i*)p);
+		__m128i t = _mm_or_si128(
+		    _mm_or_si128(_mm_cmpeq_epi8(x, space), _mm_cmpeq_epi8(x, tab)),
+		    _mm_or_si128(_mm_cmpeq_epi8(x, lf), _mm_cmpeq_epi8(x, cr)));
+		unsigned mask = ~(unsigned)_mm_movemask_epi8(t) & 0xFFFF;
+		if (mask != 0) {
+			p += LEPT_CTZ(mask);
+			return p < end ? p : end;
+		}
+	}
+#else
+	/* SWAR：缩进以空格为主，整字均为空格时一次跳过 */
+	const size_t spaces = (size_t)-1 / 255 * ' ';
+	for (; p < end && (size_t)(lim - p) >= sizeof(size_t);
+	     p += sizeof(size_t)) {
+		size_t x;
+		memcpy(&x, p, sizeof(x));
+		if (x != spaces)
+			break;
+	}
+#endif
+	for (; p < end; p++)
+		if (!ISWHITESPACE(*p))
+			return p;
+	return end;
+}
+
+static void lept_parse_whitespace(lept_context* c) {
+	/* 紧凑 Json 中多数位置没有空白，先做单字节判断 */
+	if (c->json < c->end && ISWHITESPACE(*c->json))
+		c->json = lept_skip_whitespace(c->json + 1, c->end, c->limit);
+}
+
+static int lept_parse_literal(lept_context* c, const char* literal,
+                              lept_type type) {
+	size_t n = strlen(literal + 1);
+	EXPECT(c, literal[0]);
+
+	if ((size_t)(c->end - c->json) < n || memcmp(c->json, literal + 1, n) != 0)
+		return LEPT_PARSE_INVALID_VALUE;
+
+	c->json += n;
+	return type == LEPT_NULL ? EMIT(c, on_null, (c->user))
+	                         : EMIT(c, on_bool, (c->user, type == LEPT_TRUE));
+}
+
+#if 0
+static int lept_parse_null(lept_context* c, lept_value* v) {
+	EXPECT(c, 'n');
+	if (c->json[0] != 'u' || c->json[1] != 'l' || c->json[2] != 'l')
+		return LEPT_PARSE_INVALID_VALUE;
+
+	c->json += 3;
+	v->type = LEPT_NULL;
+	return LEPT_PARSE_OK;
+}
+
+static int lept_parse_false(lept_context* c, lept_value* v) {
+	EXPECT(c, 'f');
+	if (c->json[0] != 'a' || c->json[1] != 'l' || c->json[2] != 's' ||
+	    c->json[3] != 'e')
+		return LEPT_PARSE_INVALID_VALUE;
+
+	c->json += 4;
+	v->type = LEPT_FALSE;
+	return LEPT_PARSE_OK;
+}
+
+static int lept_parse_true(lept_context* c, lept_value* v) {
+	EXPECT(c, 't');
+	if (c->json[0] != 'r' || c->json[1] != 'u' || c->json[2] != 'e')
+		return LEPT_PARSE_INVALID_VALUE;
+
+	c->json += 3;
+	v->type = LEPT_TRUE;
+	return LEPT_PARSE_OK;
+}
+#endif
+
+/* 10^0 ~ 10^22 均可被双精度浮点数精确表示 */
+static const double lept_pow10[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+/* 5^q (q = -342 ~ 308) 的 128 位截断近似值，高 64 位在前，定义见文件末尾 */
+#define LEPT_POW5_MIN (-342)
+#define LEPT_POW5_MAX 308
+static const uint64_t lept_pow5_128[2 * (LEPT_POW5_MAX - LEPT_POW5_MIN + 1)];
+
+/* 64 位乘法取 128 位结果 */
+static uint64_t lept_mul128(uint64_t a, uint64_t b, uint64_t* hi) {
+#if defined(__SIZEOF_INT128__)
+	unsigned __int128 r = (unsigned __int128)a * b;
+	*hi = (uint64_t)(r >> 64);
+	return (uint64_t)r;
+#else
+	uint64_t a_lo = (uint32_t)a, a_hi = a >> 32;
+	uint64_t b_lo = (uint32_t)b, b_hi = b >> 32;
+	uint64_t p0 = a_lo * b_lo, p1 = a_lo * b_hi, p2 = a_hi * b_lo,
+	         p3 = a_hi * b_hi;
+	uint64_t mid = (p0 >> 32) + (uint32_t)p1 + (uint32_t)p2;
+	*hi = p3 + (p1 >> 32) + (p2 >> 32) + (mid >> 32);
+	return (mid << 32) | (uint32_t)p0;
+#endif
+}
+
+static int lept_clz64(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_clzll(x);
+#else
+	int n = 0;
+	while (!(x & ((uint64_t)1 << 63))) {
+		x <<= 1;
+		n++;
+	}
+	return n;
+#endif
+}
+
+static int lept_eisel_lemire(uint64_t w, long q, uint64_t* bits) {
+	uint64_t lo, hi, mantissa;
+	const uint64_t* t;
+	int lz, upperbit, shift;
+	long power2;
+
+	if (q < LEPT_POW5_MIN) {
+		/* w * 10^q 小于最小非规格化数的一半，舍入为 0 */
+		*bits = 0;
+		return 1;
+	}
+	if (q > LEPT_POW5_MAX) {
+		*bits = (uint64_t)0x7FF << 52;
+		return 1;
+	}
+
+	/* 规格化尾数，与 5^q 的近似值相乘，56 位精度不足时补乘低 64 位 */
+	lz = lept_clz64(w);
+	w <<= lz;
+	t = lept_pow5_128 + 2 * (q - LEPT_POW5_MIN);
+	lo = lept_mul128(w, t[0], &hi);
+	if ((hi & 0x1FF) == 0x1FF) {
+		uint64_t hi2;
+		lept_mul128(w, t[1], &hi2);
+		lo += hi2;
+		if (hi2 > lo)
+			hi++;
+	}
+
+	upperbit = (int)(hi >> 63);
+	shift = upperbit + 64 - 52 - 3;
+	mantissa = hi >> shift;
+	/* floor(q * log2(10)) + 63，右移为算术移位 */
+	power2 = (((152170L + 65536L) * q) >> 16) + 63 + upperbit - lz + 1023;
+
+	/* 非规格化数 */
+	if (power2 <= 0) {
+		if (-power2 + 1 >= 64) {
+			*bits = 0;
+			return 1;
+		}
+		mantissa >>= -power2 + 1;
+		mantissa += mantissa & 1;
+		mantissa >>= 1;
+		power2 = mantissa < ((uint64_t)1 << 52) ? 0 : 1;
+		*bits = (mantissa & (((uint64_t)1 << 52) - 1)) | ((uint64_t)power2 << 52);
+		return 1;
+	}
+
+	/* 恰好位于两个浮点数中间时向偶数舍入 */
+	if (lo <= 1 && q >= -4 && q <= 23 && (mantissa & 3) == 1 &&
+	    (mantissa << shift) == hi)
+		mantissa &= ~(uint64_t)1;
+
+	mantissa += mantissa & 1;
+	mantissa >>= 1;
+	if (mantissa >= ((uint64_t)2 << 52)) {
+		mantissa = (uint64_t)1 << 52;
+		power2++;
+	}
+	mantissa &= ~((uint64_t)1 << 52);
+	if (power2 >= 0x7FF) {
+		power2 = 0x7FF;
+		mantissa = 0;
+	}
+	*bits = mantissa | ((uint64_t)power2 << 52);
+	return 1;
+}
+
+static double lept_strtod_fallback(lept_context* c, const char* begin,
+                                   const char* end) {
+	size_t head = c->top, len = (size_t)(end - begin);
+	char point = localeconv()->decimal_point[0];
+	char *buf, *q;
+	double d;
+
+	/* 在解析栈上复制数字，并将 '.' 替换为当前区域设置的小数点 */
+	buf = (char*)lept_context_push(c, len + 1);
+	memcpy(buf, begin, len);
+	buf[len] = '\0';
+	if (point != '.' && (q = strchr(buf, '.')) != NULL)
+		*q = point;
+
+	d = strtod(buf, NULL);
+	c->top = head;
+	return d;
+}
+
+/* 小端序平台使用 SWAR 一次处理 8 位数字 */
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__)
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define LEPT_SWAR_DIGITS
+#endif
+#elif defined(_M_X64) || defined(_M_IX86) || defined(_M_ARM64)
+#define LEPT_SWAR_DIGITS
+#endif
+
+#ifdef LEPT_SWAR_DIGITS
+static uint64_t lept_load8(const char* p) {
+	uint64_t x;
+	memcpy(&x, p, sizeof(x));
+	return x;
+}
+
+/* 8 字节均为 '0' ~ '9' */
+static int lept_is_eight_digits(uint64_t x) {
+	return ((x & 0xF0F0F0F0F0F0F0F0ULL) |
+	        (((x + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) ==
+	       0x3333333333333333ULL;
+}
+
+/* 两两合并相邻数字，三次乘法得到 8 位十进制数值 */
+static uint64_t lept_parse_eight_digits(uint64_t x) {
+	const uint64_t mask = 0x000000FF000000FFULL;
+	const uint64_t mul1 = 0x000F424000000064ULL; /* 100 + (1000000 << 32) */
+	const uint64_t mul2 = 0x0000271000000001ULL; /* 1 + (10000 << 32) */
+	x -= 0x3030303030303030ULL;
+	x = (x * 10) + (x >> 8);
+	x = (((x & mask) * mul1) + (((x >> 16) & mask) * mul2)) >> 32;
+	return (uint32_t)x;
+}
+#endif
+
+/* 尾数最多累积 19 位有效数字，超出部分记为截断 */
+#define LEPT_MAX_DIGITS 19
+
+static int lept_parse_number(lept_context* c, double* n) {
+	const char *p = c->json, *end = c->end;
+	uint64_t m = 0, bits;
+	long exp10 = 0;
+	int neg = 0, nd = 0, truncated = 0;
+
+	/* 校验语法的同时累积尾数和指数，越过 end 的字符视为 '\0' */
+	if (PEEK_AT(p, end) == '-') {
+		neg = 1;
+		p++;
+	}
+	if (PEEK_AT(p, end) == '0')
+		p++;
+	else {
+		if (!ISDIGIT1TO9(PEEK_AT(p, end)))
+			return LEPT_PARSE_INVALID_VALUE;
+		m = (uint64_t)(*p++ - '0');
+		nd = 1;
+		for (;;) {
+#ifdef LEPT_SWAR_DIGITS
+			if (nd <= LEPT_MAX_DIGITS - 8 && end - p >= 8 &&
+			    lept_is_eight_digits(lept_load8(p))) {
+				m = m * 100000000 + lept_parse_eight_digits(lept_load8(p));
+				nd += 8;
+				p += 8;
+				continue;
+			}
+#endif
+			if (!ISDIGIT(PEEK_AT(p, end)))
+				break;
+			if (nd < LEPT_MAX_DIGITS) {
+				m = m * 10 + (uint64_t)(*p - '0');
+				nd++;
+			} else {
+				exp10++;
+				truncated |= *p != '0';
+			}
+			p++;
+		}
+	}
+	if (PEEK_AT(p, end) == '.') {
+		p++;
+		if (!ISDIGIT(PEEK_AT(p, end)))
+			return LEPT_PARSE_INVALID_VALUE;
+		for (;;) {
+#ifdef LEPT_SWAR_DIGITS
+			/* 前导 0 不计入有效数字，只在尾数非 0 后使用 SWAR */
+			if (nd > 0 && nd <= LEPT_MAX_DIGITS - 8 && end - p >= 8 &&
+			    lept_is_eight_digits(lept_load8(p))) {
+				m = m * 100000000 + lept_parse_eight_digits(lept_load8(p));
+				nd += 8;
+				exp10 -= 8;
+				p += 8;
+				continue;
+			}
+#endif
+			if (!ISDIGIT(PEEK_AT(p, end)))
+				break;
+			if (nd < LEPT_MAX_DIGITS) {
+				m = m * 10 + (uint64_t)(*p - '0');
+				nd += m != 0;
+				exp10--;
+			} else
+				truncated |= *p != '0';
+			p++;
+		}
+	}
+	if (PEEK_AT(p, end) == 'E' || PEEK_AT(p, end) == 'e') {
+		long e = 0;
+		int eneg = 0;
+		p++;
+		if (PEEK_AT(p, end) == '+' || PEEK_AT(p, end) == '-')
+			eneg = *p++ == '-';
+		if (!ISDIGIT(PEEK_AT(p, end)))
+			return LEPT_PARSE_INVALID_VALUE;
+		/* 指数过大时已必然上溢或下溢，停止累积防止溢出 */
+		for (; ISDIGIT(PEEK_AT(p, end)); p++)
+			if (e < 100000)
+				e = e * 10 + (*p - '0');
+		exp10 += eneg ? -e : e;
+	}
+
+	if (m == 0)
+		bits = 0;
+	else if (!truncated && m <= ((uint64_t)1 << 53) && exp10 >= -22 &&
+	         exp10 <= 22
+#if defined(__FLT_EVAL_METHOD__)
+	         && __FLT_EVAL_METHOD__ == 0
+#endif
+	) {
+		/* Clinger 快速路径：尾数和 10 的幂均可精确表示，一次舍入即得正确结果 */
+		double d = (double)m;
+		d = exp10 < 0 ? d / lept_pow10[-exp10] : d * lept_pow10[exp10];
+		memcpy(&bits, &d, sizeof(d));
+	} else {
+		uint64_t bits2;
+		lept_eisel_lemire(m, exp10, &bits);
+
+		/* 尾数被截断时，真实值位于 m 与 m + 1 之间，两端结果一致才可采用 */
+		if (truncated &&
+		    (!lept_eisel_lemire(m + 1, exp10, &bits2) || bits != bits2)) {
+			double d = fabs(lept_strtod_fallback(c, c->json, p));
+			memcpy(&bits, &d, sizeof(d));
+		}
+	}
+
+	/* 数字上界 */
+	if (bits == (uint64_t)0x7FF << 52)
+		return LEPT_PARSE_NUMBER_TOO_BIG;
+
+	if (neg)
+		bits |= (uint64_t)1 << 63;
+	memcpy(n, &bits, sizeof(bits));
+	c->json = p;
+	return LEPT_PARSE_OK;
+}
+
+static const char* lept_parse_hex4(const char* p, const char* end,
+                                   unsigned* u) {
+	int i = 0;
+	*u = 0;
+	if (end - p < 4)
+		return NULL;
+
+	/* 4 位 16 进制数字 */
+	for (i = 0; i < 4; i++) {
+		char ch = *p++;
+		*u <<= 4;
+
+		/* 使用位操作求解 */
+		if (ch >= '0' && ch <= '9')
+			*u |= ch - '0';
+		else if (ch >= 'A' && ch <= 'F')
+			*u |= ch - ('A' - 10);
+		else if (ch >= 'a' && ch <= 'f')
+			*u |= ch - ('a' - 10);
+		else
+			return NULL;
+	}
+
+	return p;
+}
+
+static size_t lept_encode_utf8(char* buf, unsigned u) {
+	if (u <= 0x7F) {
+		buf[0] = u & 0xFF;
+		return 1;
+	} else if (u <= 0x7FF) {
+		buf[0] = 0xC0 | ((u >> 6) & 0xFF);
+		buf[1] = 0x80 | (u & 0x3F);
+		return 2;
+	} else if (u <= 0xFFFF) {
+		buf[0] = 0xE0 | ((u >> 12) & 0xFF);
+		buf[1] = 0x80 | ((u >> 6) & 0x3F);
+		buf[2] = 0x80 | (u & 0x3F);
+		return 3;
+	} else {
+		assert(u <= 0x10FFFF);
+		buf[0] = 0xF0 | ((u >> 18) & 0xFF);
+		buf[1] = 0x80 | ((u >> 12) & 0x3F);
+		buf[2] = 0x80 | ((u >> 6) & 0x3F);
+		buf[3] = 0x80 | (u & 0x3F);
+		return 4;
+	}
+}
+
+static const char* lept_parse_escape(const char* p, const char* end,
+                                     char* buf, size_t* n, int* ret) {
+	unsigned u, u2;
+	char ch;
+
+	/* 转义字符处理 */
+	switch (p < end ? *p++ : '\0') {
+	case '\"':
+		ch = '\"';
+		break;
+	case '\\':
+		ch = '\\';
+		break;
+	case '/':
+		ch = '/';
+		break;
+	case 'b':
+		ch = '\b';
+		break;
+	case 'f':
+		ch = '\f';
+		break;
+	case 'n':
+		ch = '\n';
+		break;
+	case 'r':
+		ch = '\r';
+		break;
 	case 't':
-		return lept_parse_literal(c, v, "true", LEPT_TRUE);
-	case '"':
-		return lept_parse_string(c, v);
-	case '[':
-		return lept_parse_array(c, v);
-	case '{':
-		return lept_parse_object(c, v);
-	case '\0':
-		return LEPT_PARSE_EXPECT_VALUE;
+		ch = '\t';
+		break;
+	case 'u':
+		if (!(p = lept_parse_hex4(p, end, &u))) {
+			*ret = LEPT_PARSE_INVALID_UNICODE_HEX;
+			return NULL;
+		}
+		if (u >= 0xD800 && u <= 0xDBFF) {
+			if (end - p < 2 || p[0] != '\\' || p[1] != 'u') {
+				*ret = LEPT_PARSE_INVALID_UNICODE_SURROGATE;
+				return NULL;
+			}
+			if (!(p = lept_parse_hex4(p + 2, end, &u2))) {
+				*ret = LEPT_PARSE_INVALID_UNICODE_HEX;
+				return NULL;
+			}
+			if (u2 < 0xDC00 || u2 > 0xDFFF) {
+				*ret = LEPT_PARSE_INVALID_UNICODE_SURROGATE;
+				return NULL;
+			}
+			u = (((u - 0xD800) << 10) | (u2 - 0xDC00)) + 0x10000;
+		}
+		*n = lept_encode_utf8(buf, u);
+		return p;
 	default:
-		return lept_parse_number(c, v);
+		*ret = LEPT_PARSE_INVALID_STRING_ESCAPE;
+		return NULL;
 	}
+
+	buf[0] = ch;
+	*n = 1;
+	return p;
 }
 
-static void lept_stringify_string(lept_context* c, const char* s, size_t len) {
-	static const char hex_digits[] = {'0', '1', '2', '3', '4', '5', '6', '7',
-	                                  '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'};
-	size_t i, size;
-	char *head, *p;
-	assert(s != NULL);
-	p = head = lept_context_push(c, size = len * 6 + 2); /* "\u00xx..." */
-	*p++ = '"';
-	for (i = 0; i < len; i++) {
-		unsigned char ch = (unsigned char)s[i];
+static int lept_parse_string_raw(lept_context* c, char** str, size_t* len) {
+	size_t head = c->top, n;
+	char buf[4];
+	int ret;
+	const char* p;
+	EXPECT(c, '\"');
+	p = c->json;
+	for (;;) {
+		char ch;
+
+		/* 无需处理的连续字符一次性入栈 */
+		const char* q = lept_scan_string(p, c->end, c->limit);
+		if (q != p) {
+			PUTS(c, p, (size_t)(q - p));
+			p = q;
+		}
+
+		if (p == c->end)
+			STRING_ERROR(LEPT_PARSE_MISS_QUOTATION_MARK);
+		ch = *p++;
 		switch (ch) {
 		case '\"':
-			*p++ = '\\';
-			*p++ = '\"';
-			break;
+			*len = c->top - head;
+			*str = lept_context_pop(c, *len);
+			c->json = p;
+			return LEPT_PARSE_OK;
 		case '\\':
-			*p++ = '\\';
-			*p++ = '\\';
+			if (!(p = lept_parse_escape(p, c->end, buf, &n, &ret)))
+				STRING_ERROR(ret);
+			PUTS(c, buf, n);
 			break;
-		case '\b':
-			*p++ = '\\';
-			*p++ = 'b';
+		default:
+			/* 不合法字符处理 */
+			/* unescaped = %x20-21 / %x23-5B / %x5D-10FFFF */
+			if ((unsigned char)ch < 0x20)
+				STRING_ERROR(LEPT_PARSE_INVALID_STRING_CHAR);
+
+			PUTC(c, ch);
+		}
+	}
+}
+
+static int lept_parse_string_insitu(lept_context* c, char** str,
+                                    size_t* len) {
+	/* 解码结果不会长于转义前的输入，写位置始终不超过读位置 */
+	char* head = (char*)c->json + 1;
+	char* w = head;
+	const char* p;
+	size_t n;
+	int ret;
+	EXPECT(c, '\"');
+	p = c->json;
+	for (;;) {
+		char ch;
+
+		/* 无需处理的连续字符，出现转义前读写位置相同无需移动 */
+		const char* q = lept_scan_string(p, c->end, c->limit);
+		if (q != p) {
+			if (w != p)
+				memmove(w, p, (size_t)(q - p));
+			w += q - p;
+			p = q;
+		}
+
+		if (p == c->end)
+			return LEPT_PARSE_MISS_QUOTATION_MARK;
+		ch = *p++;
+		switch (ch) {
+		case '\"':
+			*w = '\0';
+			*str = head;
+			*len = (size_t)(w - head);
+			c->json = p;
+			return LEPT_PARSE_OK;
+		case '\\':
+			if (!(p = lept_parse_escape(p, c->end, w, &n, &ret)))
+				return ret;
+			w += n;
 			break;
-		case '\f':
-			*p++ = '\\';
-			*p++ = 'f';
+		default:
+			if ((unsigned char)ch < 0x20)
+				return LEPT_PARSE_INVALID_STRING_CHAR;
+			*w++ = ch;
+		}
+	}
+}
+
+static int lept_parse_string(lept_context* c, int key) {
+	char* s;
+	size_t len;
+	int ret = c->insitu ? lept_parse_string_insitu(c, &s, &len)
+	                    : lept_parse_string_raw(c, &s, &len);
+	if (ret != LEPT_PARSE_OK)
+		return ret;
+	if (LEPT_LEN_OVERFLOW(c, len))
+		return LEPT_PARSE_TOO_LONG;
+	return key ? EMIT(c, on_key, (c->user, s, len))
+	           : EMIT(c, on_string, (c->user, s, len));
+}
+
+static int lept_parse_key(lept_context* c) {
+	int ret;
+	if (PEEK(c) != '"')
+		return LEPT_PARSE_MISS_KEY;
+	if ((ret = lept_parse_string(c, 1)) != LEPT_PARSE_OK)
+		return ret;
+
+	/* 解析中间 : */
+	lept_parse_whitespace(c);
+	if (PEEK(c) != ':')
+		return LEPT_PARSE_MISS_COLON;
+	c->json++;
+	lept_parse_whitespace(c);
+	return LEPT_PARSE_OK;
+}
+
+static int lept_parse_value(lept_context* c) {
+	/* 只处理本次调用打开的层，出错时由调用者清理 */
+	size_t base = c->depth;
+	lept_frame* f;
+	double n;
+	int ret;
+
+	for (;;) {
+		/* 解析一个值；非空的数组或对象入栈后接着解析其首个元素 */
+		switch (PEEK(c)) {
+		case 'n':
+			ret = lept_parse_literal(c, "null", LEPT_NULL);
 			break;
-		case '\n':
-			*p++ = '\\';
-			*p++ = 'n';
+		case 'f':
+			ret = lept_parse_literal(c, "false", LEPT_FALSE);
 			break;
-		case '\r':
-			*p++ = '\\';
-			*p++ = 'r';
+		case 't':
+			ret = lept_parse_literal(c, "true", LEPT_TRUE);
 			break;
-		case '\t':
-			*p++ = '\\';
-			*p++ = 't';
+		case '"':
+			ret = lept_parse_string(c, 0);
 			break;
+		case '[':
+			if (lept_context_open(c, LEPT_ARRAY) == NULL)
+				return LEPT_PARSE_TOO_DEEP;
+			c->json++;
+			if ((ret = EMIT(c, on_start_array, (c->user))) != LEPT_PARSE_OK)
+				return ret;
+			lept_parse_whitespace(c);
+
+			/* 空类型数组解析 */
+			if (PEEK(c) == ']') {
+				c->json++;
+				c->depth--;
+				ret = EMIT(c, on_end_array, (c->user, 0));
+				break;
+			}
+			continue;
+		case '{':
+			if (lept_context_open(c, LEPT_OBJECT) == NULL)
+				return LEPT_PARSE_TOO_DEEP;
+			c->json++;
+			if ((ret = EMIT(c, on_start_object, (c->user))) != LEPT_PARSE_OK)
+				return ret;
+			lept_parse_whitespace(c);
+
+			/* 空对象处理 */
+			if (PEEK(c) == '}') {
+				c->json++;
+				c->depth--;
+				ret = EMIT(c, on_end_object, (c->user, 0));
+				break;
+			}
+			if ((ret = lept_parse_key(c)) != LEPT_PARSE_OK)
+				return ret;
+			continue;
+		case '\0':
+			/* 只有输入末尾才是缺少值，长度限定输入中的 '\0' 为非法字符 */
+			return c->json == c->end ? LEPT_PARSE_EXPECT_VALUE
+			                         : LEPT_PARSE_INVALID_VALUE;
 		default:
-			if (ch < 0x20) {
-				*p++ = '\\';
-				*p++ = 'u';
-				*p++ = '0';
-				*p++ = '0';
-				*p++ = hex_digits[ch >> 4];
-				*p++ = hex_digits[ch & 15];
-			} else
-				*p++ = s[i];
+			if ((ret = lept_parse_number(c, &n)) == LEPT_PARSE_OK)
+				ret = EMIT(c, on_number, (c->user, n));
+			break;
+		}
+		if (ret != LEPT_PARSE_OK)
+			return ret;
+
+		/* 值已完成：计入所在容器，处理 ',' 或逐层闭合 */
+		/* 出错时已发出的元素由事件处理函数负责释放 */
+		for (;;) {
+			if (c->depth == base)
+				return LEPT_PARSE_OK;
+			f = &c->frames[c->depth - 1];
+			f->size++;
+
+			/* parse ws [comma | right-bracket] ws */
+			lept_parse_whitespace(c);
+			if (PEEK(c) == ',') {
+				c->json++;
+				lept_parse_whitespace(c);
+				if (f->type == LEPT_OBJECT &&
+				    (ret = lept_parse_key(c)) != LEPT_PARSE_OK)
+					return ret;
+				break;
+			}
+			if (f->type == LEPT_ARRAY) {
+				if (PEEK(c) != ']')
+					return LEPT_PARSE_MISS_COMMA_OR_SQUARE_BRACKET;
+				c->json++;
+				c->depth--;
+				if (LEPT_LEN_OVERFLOW(c, f->size))
+					return LEPT_PARSE_TOO_LONG;
+				ret = EMIT(c, on_end_array, (c->user, f->size));
+			} else {
+				if (PEEK(c) != '}')
+					return LEPT_PARSE_MISS_COMMA_OR_CURLY_BRACKET;
+				c->json++;
+				c->depth--;
+				if (LEPT_LEN_OVERFLOW(c, f->size))
+					return LEPT_PARSE_TOO_LONG;
+				ret = EMIT(c, on_end_object, (c->user, f->size));
+			}
+			if (ret != LEPT_PARSE_OK)
+				return ret;
+		}
+	}
+}
+
+/* Grisu2 所用的无符号扩展浮点数 f * 2^e */
+typedef struct {
+	uint64_t f;
+	int e;
+} lept_diyfp;
+
+#define LEPT_DP_SIGNIFICAND_MASK (((uint64_t)1 << 52) - 1)
+#define LEPT_DP_HIDDEN_BIT ((uint64_t)1 << 52)
+#define LEPT_DP_EXPONENT_BIAS (0x3FF + 52)
+
+/* 10^k (k = -348 + 8i) 的 64 位规格化近似值 */
+static const uint64_t lept_cached_powers_f[] = {
+	0xfa8fd5a0081c0288ULL, 0xbaaee17fa23ebf76ULL, 0x8b16fb203055ac76ULL, 0xcf42894a5dce35eaULL,
+	0x9a6bb0aa55653b2dULL, 0xe61acf033d1a45dfULL, 0xab70fe17c79ac6caULL, 0xff77b1fcbebcdc4fULL,
+	0xbe5691ef416bd60cULL, 0x8dd01fad907ffc3cULL, 0xd3515c2831559a83ULL, 0x9d71ac8fada6c9b5ULL,
+	0xea9c227723ee8bcbULL, 0xaecc49914078536dULL, 0x823c12795db6ce57ULL, 0xc21094364dfb5637ULL,
+	0x9096ea6f3848984fULL, 0xd77485cb25823ac7ULL, 0xa086cfcd97bf97f4ULL, 0xef340a98172aace5ULL,
+	0xb23867fb2a35b28eULL, 0x84c8d4dfd2c63f3bULL, 0xc5dd44271ad3cdbaULL, 0x936b9fcebb25c996ULL,
+	0xdbac6c247d62a584ULL, 0xa3ab66580d5fdaf6ULL, 0xf3e2f893dec3f126ULL, 0xb5b5ada8aaff80b8ULL,
+	0x87625f056c7c4a8bULL, 0xc9bcff6034c13053ULL, 0x964e858c91ba2655ULL, 0xdff9772470297ebdULL,
+	0xa6dfbd9fb8e5b88fULL, 0xf8a95fcf88747d94ULL, 0xb94470938fa89bcfULL, 0x8a08f0f8bf0f156bULL,
+	0xcdb02555653131b6ULL, 0x993fe2c6d07b7facULL, 0xe45c10c42a2b3b06ULL, 0xaa242499697392d3ULL,
+	0xfd87b5f28300ca0eULL, 0xbce5086492111aebULL, 0x8cbccc096f5088ccULL, 0xd1b71758e219652cULL,
+	0x9c40000000000000ULL, 0xe8d4a51000000000ULL, 0xad78ebc5ac620000ULL, 0x813f3978f8940984ULL,
+	0xc097ce7bc90715b3ULL, 0x8f7e32ce7bea5c70ULL, 0xd5d238a4abe98068ULL, 0x9f4f2726179a2245ULL,
+	0xed63a231d4c4fb27ULL, 0xb0de65388cc8ada8ULL, 0x83c7088e1aab65dbULL, 0xc45d1df942711d9aULL,
+	0x924d692ca61be758ULL, 0xda01ee641a708deaULL, 0xa26da3999aef774aULL, 0xf209787bb47d6b85ULL,
+	0xb454e4a179dd1877ULL, 0x865b86925b9bc5c2ULL, 0xc83553c5c8965d3dULL, 0x952ab45cfa97a0b3ULL,
+	0xde469fbd99a05fe3ULL, 0xa59bc234db398c25ULL, 0xf6c69a72a3989f5cULL, 0xb7dcbf5354e9beceULL,
+	0x88fcf317f22241e2ULL, 0xcc20ce9bd35c78a5ULL, 0x98165af37b2153dfULL, 0xe2a0b5dc971f303aULL,
+	0xa8d9d1535ce3b396ULL, 0xfb9b7cd9a4a7443cULL, 0xbb764c4ca7a44410ULL, 0x8bab8eefb6409c1aULL,
+	0xd01fef10a657842cULL, 0x9b10a4e5e9913129ULL, 0xe7109bfba19c0c9dULL, 0xac2820d9623bf429ULL,
+	0x80444b5e7aa7cf85ULL, 0xbf21e44003acdd2dULL, 0x8e679c2f5e44ff8fULL, 0xd433179d9c8cb841ULL,
+	0x9e19db92b4e31ba9ULL, 0xeb96bf6ebadf77d9ULL, 0xaf87023b9bf0ee6bULL,
+};
+static const short lept_cached_powers_e[] = {
+	-1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007, -980,
+	-954, -927, -901, -874, -847, -821, -794, -768, -741, -715,
+	-688, -661, -635, -608, -582, -555, -529, -502, -475, -449,
+	-422, -396, -369, -343, -316, -289, -263, -236, -210, -183,
+	-157, -130, -103, -77, -50, -24, 3, 30, 56, 83,
+	109, 136, 162, 189, 216, 242, 269, 295, 322, 348,
+	375, 402, 428, 455, 481, 508, 534, 561, 588, 614,
+	641, 667, 694, 720, 747, 774, 800, 827, 853, 880,
+	907, 933, 960, 986, 1013, 1039, 1066,
+};
+
+static lept_diyfp lept_diyfp_make(uint64_t f, int e) {
+	lept_diyfp r;
+	r.f = f;
+	r.e = e;
+	return r;
+}
+
+/* 乘积取高 64 位并四舍五入 */
+static lept_diyfp lept_diyfp_mul(lept_diyfp x, lept_diyfp y) {
+	uint64_t hi, lo = lept_mul128(x.f, y.f, &hi);
+	return lept_diyfp_make(hi + (lo >> 63), x.e + y.e + 64);
+}
+
+static lept_diyfp lept_diyfp_normalize(lept_diyfp x) {
+	int lz = lept_clz64(x.f);
+	return lept_diyfp_make(x.f << lz, x.e - lz);
+}
+
+/* 取值 d 相邻浮点数的中点 m- 与 m+，规格化到相同指数 */
+static void lept_diyfp_boundaries(lept_diyfp v, lept_diyfp* minus,
+                                  lept_diyfp* plus) {
+	lept_diyfp pl = lept_diyfp_normalize(lept_diyfp_make((v.f << 1) + 1, v.e - 1));
+	lept_diyfp mi = v.f == LEPT_DP_HIDDEN_BIT
+	                    ? lept_diyfp_make((v.f << 2) - 1, v.e - 2)
+	                    : lept_diyfp_make((v.f << 1) - 1, v.e - 1);
+	mi.f <<= mi.e - pl.e;
+	mi.e = pl.e;
+	*plus = pl;
+	*minus = mi;
+}
+
+static void lept_grisu_round(char* buf, int len, uint64_t delta, uint64_t rest,
+                             uint64_t ten_kappa, uint64_t wp_w) {
+	while (rest < wp_w && delta - rest >= ten_kappa &&
+	       (rest + ten_kappa < wp_w || wp_w - rest > rest + ten_kappa - wp_w)) {
+		buf[len - 1]--;
+		rest += ten_kappa;
+	}
+}
+
+static const uint64_t lept_pow10_u64[] = {1ULL,
+                                          10ULL,
+                                          100ULL,
+                                          1000ULL,
+                                          10000ULL,
+                                          100000ULL,
+                                          1000000ULL,
+                                          10000000ULL,
+                                          100000000ULL,
+                                          1000000000ULL,
+                                          10000000000ULL,
+                                          100000000000ULL,
+                                          1000000000000ULL,
+                                          10000000000000ULL,
+                                          100000000000000ULL,
+                                          1000000000000000ULL,
+                                          10000000000000000ULL,
+                                          100000000000000000ULL,
+                                          1000000000000000000ULL,
+                                          10000000000000000000ULL};
+
+/* 生成 [Mp - delta, Mp] 区间内最短的十进制数字串 */
+static void lept_digit_gen(lept_diyfp w, lept_diyfp mp, uint64_t delta,
+                           char* buf, int* len, int* k) {
+	const int shift = -mp.e;
+	const uint64_t one = (uint64_t)1 << shift;
+	const uint64_t wp_w = mp.f - w.f;
+	uint32_t p1 = (uint32_t)(mp.f >> shift);
+	uint64_t p2 = mp.f & (one - 1);
+	int kappa = 1;
+
+	while (kappa < 10 && p1 >= lept_pow10_u64[kappa])
+		kappa++;
+	*len = 0;
+
+	/* 整数部分 */
+	while (kappa > 0) {
+		uint32_t div = (uint32_t)lept_pow10_u64[kappa - 1];
+		uint32_t d = p1 / div;
+		uint64_t tmp;
+		p1 %= div;
+		if (d || *len)
+			buf[(*len)++] = (char)('0' + d);
+		kappa--;
+		tmp = ((uint64_t)p1 << shift) + p2;
+		if (tmp <= delta) {
+			*k += kappa;
+			lept_grisu_round(buf, *len, delta, tmp,
+			                 lept_pow10_u64[kappa] << shift, wp_w);
+			return;
+		}
+	}
+
+	/* 小数部分 */
+	for (;;) {
+		char d;
+		p2 *= 10;
+		delta *= 10;
+		d = (char)(p2 >> shift);
+		if (d || *len)
+			buf[(*len)++] = (char)('0' + d);
+		p2 &= one - 1;
+		kappa--;
+		if (p2 < delta) {
+			*k += kappa;
+			lept_grisu_round(buf, *len, delta, p2, one,
+			                 -kappa < 20 ? wp_w * lept_pow10_u64[-kappa] : 0);
+			return;
+		}
+	}
+}
+
+static void lept_grisu2(double d, char* buf, int* len, int* k) {
+	uint64_t bits;
+	lept_diyfp v, w_m, w_p, c_mk, w, wp, wm;
+	int biased_e, index;
+	double dk;
+
+	memcpy(&bits, &d, sizeof(d));
+	biased_e = (int)((bits >> 52) & 0x7FF);
+	if (biased_e != 0)
+		v = lept_diyfp_make((bits & LEPT_DP_SIGNIFICAND_MASK) + LEPT_DP_HIDDEN_BIT,
+		                    biased_e - LEPT_DP_EXPONENT_BIAS);
+	else
+		v = lept_diyfp_make(bits & LEPT_DP_SIGNIFICAND_MASK,
+		                    1 - LEPT_DP_EXPONENT_BIAS);
+	lept_diyfp_boundaries(v, &w_m, &w_p);
+
+	/* 选取缓存的 10 的幂，使乘积指数落在 [-60, -32] */
+	dk = (-61 - w_p.e) * 0.30102999566398114 + 347;
+	index = (int)dk;
+	if (dk - index > 0.0)
+		index++;
+	index = (index >> 3) + 1;
+	*k = -(-348 + (index << 3));
+	c_mk = lept_diyfp_make(lept_cached_powers_f[index], lept_cached_powers_e[index]);
+
+	w = lept_diyfp_mul(lept_diyfp_normalize(v), c_mk);
+	wp = lept_diyfp_mul(w_p, c_mk);
+	wm = lept_diyfp_mul(w_m, c_mk);
+	wm.f++;
+	wp.f--;
+	lept_digit_gen(w, wp, wp.f - wm.f, buf, len, k);
+}
+
+static const char lept_digits_lut[] = "00010203040506070809"
+                                      "10111213141516171819"
+                                      "20212223242526272829"
+                                      "30313233343536373839"
+                                      "40414243444546474849"
+                                      "50515253545556575859"
+                                      "60616263646566676869"
+                                      "70717273747576777879"
+                                      "80818283848586878889"
+                                      "90919293949596979899";
+
+/* 无符号整数转十进制，两位一组查表 */
+static int lept_u64toa(uint64_t u, char* buf) {
+	char tmp[20];
+	int n = 0, len;
+	while (u >= 100) {
+		unsigned r = (unsigned)(u % 100);
+		u /= 100;
+		tmp[n++] = lept_digits_lut[2 * r + 1];
+		tmp[n++] = lept_digits_lut[2 * r];
+	}
+	tmp[n++] = (char)('0' + u % 10);
+	if (u >= 10)
+		tmp[n++] = (char)('0' + u / 10);
+	for (len = 0; n > 0; len++)
+		buf[len] = tmp[--n];
+	return len;
+}
+
+/* 与 %.17g 相同的记数法选择：十进制指数在 [-4, 17) 内使用定点表示 */
+static int lept_dtoa(double d, char* buf) {
+	char* p = buf;
+	int len, k, n, i;
+	uint64_t bits;
+
+	memcpy(&bits, &d, sizeof(d));
+	if (((bits >> 52) & 0x7FF) == 0x7FF)
+		return sprintf(buf, "%.17g", d); /* inf 与 nan 保持原有输出 */
+	if (bits >> 63) {
+		*p++ = '-';
+		d = -d;
+	}
+
+	/* 整数快速路径，包括 0 与 -0 */
+	if (d < 9007199254740992.0 && d == (double)(uint64_t)d)
+		return (int)(p - buf) + lept_u64toa((uint64_t)d, p);
+
+	lept_grisu2(d, p, &len, &k);
+	n = len + k; /* 小数点位置 */
+
+	if (n > -4 && n <= 17) {
+		if (n >= len) {
+			/* 1234e7 -> 12340000000 */
+			for (i = len; i < n; i++)
+				p[i] = '0';
+			p += n;
+		} else if (n > 0) {
+			/* 1234e-2 -> 12.34 */
+			memmove(p + n + 1, p + n, (size_t)(len - n));
+			p[n] = '.';
+			p += len + 1;
+		} else {
+			/* 1234e-6 -> 0.001234 */
+			memmove(p + 2 - n, p, (size_t)len);
+			p[0] = '0';
+			p[1] = '.';
+			for (i = 2; i < 2 - n; i++)
+				p[i] = '0';
+			p += 2 - n + len;
+		}
+	} else {
+		/* 1234e30 -> 1.234e+33，指数至少两位 */
+		int e = n - 1;
+		if (len > 1) {
+			memmove(p + 2, p + 1, (size_t)(len - 1));
+			p[1] = '.';
+			p += len + 1;
+		} else
+			p++;
+		*p++ = 'e';
+		*p++ = e < 0 ? '-' : '+';
+		if (e < 0)
+			e = -e;
+		if (e < 10)
+			*p++ = '0';
+		p += lept_u64toa((uint64_t)e, p);
+	}
+	return (int)(p - buf);
+}
+
+static char* lept_stringify_push(lept_context* c, size_t size) {
+	char* ret;
+	if (c->top + size >= c->size)
+		lept_stringify_grow(c, size);
+	ret = c->stack + c->top;
+	c->top += size;
+	return ret;
+}
+
+static void lept_stringify_grow(lept_context* c, size_t size) {
+	/* 流式生成时写出已满的块，块内始终留有空间，缓冲区不会扩容 */
+	if (c->write != NULL) {
+		lept_stringify_flush(c);
+		return;
+	}
+	if (c->sbuf != NULL) {
+		lept_stringify_spill(c);
+		return;
+	}
+	while (c->top + size >= c->size)
+		c->size += c->size >> 1;
+	c->stack = (char*)lept_mem_realloc(c->alloc, c->stack, c->size);
+}
+
+static void lept_stringify_flush(lept_context* c) {
+	if (c->top > 0 && !c->werr && c->write(c->wuser, c->stack, c->top) != 0)
+		c->werr = 1;
+	c->top = 0;
+}
+
+static void lept_stringify_spill(lept_context* c) {
+	c->sbuf->len = c->top;
+	c->stack = c->sbuf->spill;
+	c->size = LEPT_STRINGIFY_SPILL_SIZE;
+	c->top = 0;
+	c->write = lept_stringify_buffer_write;
+	c->wuser = c->sbuf;
+	c->werr = 0;
+}
+
+static int lept_stringify_buffer_write(void* user, const char* s, size_t len) {
+	lept_stringify_buf* b = (lept_stringify_buf*)user;
+	/* 保留一个字节给 '\0' */
+	if (b->len + 1 < b->size) {
+		size_t n = b->size - 1 - b->len;
+		memcpy(b->buf + b->len, s, len < n ? len : n);
+	}
+	b->len += len;
+	return 0;
+}
+
+static void lept_stringify_string(lept_context* c, const char* s, size_t len) {
+	static const char hex_digits[] = {'0', '1', '2', '3', '4', '5', '6', '7',
+	                                  '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'};
+	/* 控制字符的转义字母，0 表示使用 \u00xx */
+	static const char escapes[0x20] = {
+	    0, 0, 0, 0, 0, 0, 0, 0, 'b', 't', 'n', 0, 'f', 'r', 0, 0,
+	    0, 0, 0, 0, 0, 0, 0, 0, 0,   0,   0,   0, 0,   0,   0, 0};
+	const char* end = s + len;
+	const char* q;
+	size_t n;
+	char* p;
+	assert(s != NULL);
+	OUTC(c, '"');
+	for (;;) {
+		/* 无需转义的连续字符整段复制，流式生成时每段不超过一块 */
+		q = lept_scan_string(s, end, end);
+		while (s != q) {
+			n = (size_t)(q - s);
+			/* 调用者缓冲区放不下时先转为写出，由写出函数复制放得下的部分 */
+			if (c->sbuf != NULL && c->write == NULL && c->top + n >= c->size)
+				lept_stringify_spill(c);
+			if (c->write != NULL && n >= c->size)
+				n = c->size - 1;
+			memcpy(lept_stringify_push(c, n), s, n);
+			s += n;
+		}
+		if (s == end)
+			break;
+
+		/* '"'、'\\' 或控制字符 */
+		p = lept_stringify_push(c, 6);
+		*p++ = '\\';
+		if ((unsigned char)*s >= 0x20)
+			*p++ = *s;
+		else if (escapes[(unsigned char)*s] != 0)
+			*p++ = escapes[(unsigned char)*s];
+		else {
+			*p++ = 'u';
+			*p++ = '0';
+			*p++ = '0';
+			*p++ = hex_digits[(unsigned char)*s >> 4];
+			*p++ = hex_digits[*s & 15];
 		}
+		c->top = (size_t)(p - c->stack);
+		s++;
 	}
-	*p++ = '"';
-	c->top -= size - (p - head);
+	OUTC(c, '"');
 }
 
 static void lept_stringify_value(lept_context* c, const lept_value* v) {
 	size_t i;
+	if (c->write != NULL && c->werr)
+		return;
+	LEPT_LOAD(v);
 	switch (v->type) {
 	case LEPT_NULL:
-		PUTS(c, "null", 4);
+		OUTS(c, "null", 4);
 		break;
 	case LEPT_FALSE:
-		PUTS(c, "false", 5);
+		OUTS(c, "false", 5);
 		break;
 	case LEPT_TRUE:
-		PUTS(c, "true", 4);
+		OUTS(c, "true", 4);
 		break;
 	case LEPT_NUMBER:
-		c->top -= 32 - sprintf(lept_context_push(c, 32), "%.17g", v->u.n);
+		c->top -= 32 - lept_dtoa(v->u.n, lept_stringify_push(c, 32));
 		break;
 	case LEPT_STRING:
-		lept_stringify_string(c, v->u.s.s, v->u.s.len);
+		lept_stringify_string(c, LEPT_STR(v), LEPT_STRLEN(v));
 		break;
 	case LEPT_ARRAY:
-		PUTC(c, '[');
-		for (i = 0; i < v->u.a.size; i++) {
+		OUTC(c, '[');
+		for (i = 0; i < LEPT_NELEMS(v); i++) {
 			if (i > 0)
-				PUTC(c, ',');
-			lept_stringify_value(c, &v->u.a.e[i]);
+				OUTC(c, ',');
+			lept_stringify_value(c, &LEPT_ELEMS(v)[i]);
 		}
-		PUTC(c, ']');
+		OUTC(c, ']');
 		break;
 	case LEPT_OBJECT:
-		PUTC(c, '{');
-		for (i = 0; i < v->u.o.size; i++) {
+		OUTC(c, '{');
+		for (i = 0; i < LEPT_NMEMBERS(v); i++) {
 			if (i > 0)
-				PUTC(c, ',');
-			lept_stringify_string(c, v->u.o.m[i].k, v->u.o.m[i].klen);
-			PUTC(c, ':');
-			lept_stringify_value(c, &v->u.o.m[i].v);
+				OUTC(c, ',');
+			lept_stringify_string(c, LEPT_MEMBERS(v)[i].k,
+			                      LEPT_MEMBERS(v)[i].klen);
+			OUTC(c, ':');
+			lept_stringify_value(c, &LEPT_MEMBERS(v)[i].v);
 		}
-		PUTC(c, '}');
+		OUTC(c, '}');
 		break;
 	default:
 		assert(0 && "invalid type");
 	}
-}
\ No newline at end of file
+}
+
+/* 5^q 的 128 位近似值表，q = -342 ~ 308 */
+static const uint64_t lept_pow5_128[2 * (LEPT_POW5_MAX - LEPT_POW5_MIN + 1)] = {
+	0xeef453d6923bd65aULL, 0x113faa2906a13b3fULL,
+	0x9558b4661b6565f8ULL, 0x4ac7ca59a424c507ULL,
+	0xbaaee17fa23ebf76ULL, 0x5d79bcf00d2df649ULL,
+	0xe95a99df8ace6f53ULL, 0xf4d82c2c107973dcULL,
+	0x91d8a02bb6c10594ULL, 0x79071b9b8a4be869ULL,
+	0xb64ec836a47146f9ULL, 0x9748e2826cdee284ULL,
+	0xe3e27a444d8d98b7ULL, 0xfd1b1b2308169b25ULL,
+	0x8e6d8c6ab0787f72ULL, 0xfe30f0f5e50e20f7ULL,
+	0xb208ef855c969f4fULL, 0xbdbd2d335e51a935ULL,
+	0xde8b2b66b3bc4723ULL, 0xad2c788035e61382ULL,
+	0x8b16fb203055ac76ULL, 0x4c3bcb5021afcc31ULL,
+	0xaddcb9e83c6b1793ULL, 0xdf4abe242a1bbf3dULL,
+	0xd953e8624b85dd78ULL, 0xd71d6dad34a2af0dULL,
+	0x87d4713d6f33aa6bULL, 0x8672648c40e5ad68ULL,
+	0xa9c98d8ccb009506ULL, 0x680efdaf511f18c2ULL,
+	0xd43bf0effdc0ba48ULL, 0x0212bd1b2566def2ULL,
+	0x84a57695fe98746dULL, 0x014bb630f7604b57ULL,
+	0xa5ced43b7e3e9188ULL, 0x419ea3bd35385e2dULL,
+	0xcf42894a5dce35eaULL, 0x52064cac828675b9ULL,
+	0x818995ce7aa0e1b2ULL, 0x7343efebd1940993ULL,
+	0xa1ebfb4219491a1fULL, 0x1014ebe6c5f90bf8ULL,
+	0xca66fa129f9b60a6ULL, 0xd41a26e077774ef6ULL,
+	0xfd00b897478238d0ULL, 0x8920b098955522b4ULL,
+	0x9e20735e8cb16382ULL, 0x55b46e5f5d5535b0ULL,
+	0xc5a890362fddbc62ULL, 0xeb2189f734aa831dULL,
+	0xf712b443bbd52b7bULL, 0xa5e9ec7501d523e4ULL,
+	0x9a6bb0aa55653b2dULL, 0x47b233c92125366eULL,
+	0xc1069cd4eabe89f8ULL, 0x999ec0bb696e840aULL,
+	0xf148440a256e2c76ULL, 0xc00670ea43ca250dULL,
+	0x96cd2a865764dbcaULL, 0x380406926a5e5728ULL,
+	0xbc807527ed3e12bcULL, 0xc605083704f5ecf2ULL,
+	0xeba09271e88d976bULL, 0xf7864a44c633682eULL,
+	0x93445b8731587ea3ULL, 0x7ab3ee6afbe0211dULL,
+	0xb8157268fdae9e4cULL, 0x5960ea05bad82964ULL,
+	0xe61acf033d1a45dfULL, 0x6fb92487298e33bdULL,
+	0x8fd0c16206306babULL, 0xa5d3b6d479f8e056ULL,
+	0xb3c4f1ba87bc8696ULL, 0x8f48a4899877186cULL,
+	0xe0b62e2929aba83cULL, 0x331acdabfe94de87ULL,
+	0x8c71dcd9ba0b4925ULL, 0x9ff0c08b7f1d0b14ULL,
+	0xaf8e5410288e1b6fULL, 0x07ecf0ae5ee44dd9ULL,
+	0xdb71e91432b1a24aULL, 0xc9e82cd9f69d6150ULL,
+	0x892731ac9faf056eULL, 0xbe311c083a225cd2ULL,
+	0xab70fe17c79ac6caULL, 0x6dbd630a48aaf406ULL,
+	0xd64d3d9db981787dULL, 0x092cbbccdad5b108ULL,
+	0x85f0468293f0eb4eULL, 0x25bbf56008c58ea5ULL,
+	0xa76c582338ed2621ULL, 0xaf2af2b80af6f24eULL,
+	0xd1476e2c07286faaULL, 0x1af5af660db4aee1ULL,
+	0x82cca4db847945caULL, 0x50d98d9fc890ed4dULL,
+	0xa37fce126597973cULL, 0xe50ff107bab528a0ULL,
+	0xcc5fc196fefd7d0cULL, 0x1e53ed49a96272c8ULL,
+	0xff77b1fcbebcdc4fULL, 0x25e8e89c13bb0f7aULL,
+	0x9faacf3df73609b1ULL, 0x77b191618c54e9acULL,
+	0xc795830d75038c1dULL, 0xd59df5b9ef6a2417ULL,
+	0xf97ae3d0d2446f25ULL, 0x4b0573286b44ad1dULL,
+	0x9becce62836ac577ULL, 0x4ee367f9430aec32ULL,
+	0xc2e801fb244576d5ULL, 0x229c41f793cda73fULL,
+	0xf3a20279ed56d48aULL, 0x6b43527578c1110fULL,
+	0x9845418c345644d6ULL, 0x830a13896b78aaa9ULL,
+	0xbe5691ef416bd60cULL, 0x23cc986bc656d553ULL,
+	0xedec366b11c6cb8fULL, 0x2cbfbe86b7ec8aa8ULL,
+	0x94b3a202eb1c3f39ULL, 0x7bf7d71432f3d6a9ULL,
+	0xb9e08a83a5e34f07ULL, 0xdaf5ccd93fb0cc53ULL,
+	0xe858ad248f5c22c9ULL, 0xd1b3400f8f9cff68ULL,
+	0x91376c36d99995beULL, 0x23100809b9c21fa1ULL,
+	0xb58547448ffffb2dULL, 0xabd40a0c2832a78aULL,
+	0xe2e69915b3fff9f9ULL, 0x16c90c8f323f516cULL,
+	0x8dd01fad907ffc3bULL, 0xae3da7d97f6792e3ULL,
+	0xb1442798f49ffb4aULL, 0x99cd11cfdf41779cULL,
+	0xdd95317f31c7fa1dULL, 0x40405643d711d583ULL,
+	0x8a7d3eef7f1cfc52ULL, 0x482835ea666b2572ULL,
+	0xad1c8eab5ee43b66ULL, 0xda3243650005eecfULL,
+	0xd863b256369d4a40ULL, 0x90bed43e40076a82ULL,
+	0x873e4f75e2224e68ULL, 0x5a7744a6e804a291ULL,
+	0xa90de3535aaae202ULL, 0x711515d0a205cb36ULL,
+	0xd3515c2831559a83ULL, 0x0d5a5b44ca873e03ULL,
+	0x8412d9991ed58091ULL, 0xe858790afe9486c2ULL,
+	0xa5178fff668ae0b6ULL, 0x626e974dbe39a872ULL,
+	0xce5d73ff402d98e3ULL, 0xfb0a3d212dc8128fULL,
+	0x80fa687f881c7f8eULL, 0x7ce66634bc9d0b99ULL,
+	0xa139029f6a239f72ULL, 0x1c1fffc1ebc44e80ULL,
+	0xc987434744ac874eULL, 0xa327ffb266b56220ULL,
+	0xfbe9141915d7a922ULL, 0x4bf1ff9f0062baa8ULL,
+	0x9d71ac8fada6c9b5ULL, 0x6f773fc3603db4a9ULL,
+	0xc4ce17b399107c22ULL, 0xcb550fb4384d21d3ULL,
+	0xf6019da07f549b2bULL, 0x7e2a53a146606a48ULL,
+	0x99c102844f94e0fbULL, 0x2eda7444cbfc426dULL,
+	0xc0314325637a1939ULL, 0xfa911155fefb5308ULL,
+	0xf03d93eebc589f88ULL, 0x793555ab7eba27caULL,
+	0x96267c7535b763b5ULL, 0x4bc1558b2f3458deULL,
+	0xbbb01b9283253ca2ULL, 0x9eb1aaedfb016f16ULL,
+	0xea9c227723ee8bcbULL, 0x465e15a979c1cadcULL,
+	0x92a1958a7675175fULL, 0x0bfacd89ec191ec9ULL,
+	0xb749faed14125d36ULL, 0xcef980ec671f667bULL,
+	0xe51c79a85916f484ULL, 0x82b7e12780e7401aULL,
+	0x8f31cc0937ae58d2ULL, 0xd1b2ecb8b0908810ULL,
+	0xb2fe3f0b8599ef07ULL, 0x861fa7e6dcb4aa15ULL,
+	0xdfbdcece67006ac9ULL, 0x67a791e093e1d49aULL,
+	0x8bd6a141006042bdULL, 0xe0c8bb2c5c6d24e0ULL,
+	0xaecc49914078536dULL, 0x58fae9f773886e18ULL,
+	0xda7f5bf590966848ULL, 0xaf39a475506a899eULL,
+	0x888f99797a5e012dULL, 0x6d8406c952429603ULL,
+	0xaab37fd7d8f58178ULL, 0xc8e5087ba6d33b83ULL,
+	0xd5605fcdcf32e1d6ULL, 0xfb1e4a9a90880a64ULL,
+	0x855c3be0a17fcd26ULL, 0x5cf2eea09a55067fULL,
+	0xa6b34ad8c9dfc06fULL, 0xf42faa48c0ea481eULL,
+	0xd0601d8efc57b08bULL, 0xf13b94daf124da26ULL,
+	0x823c12795db6ce57ULL, 0x76c53d08d6b70858ULL,
+	0xa2cb1717b52481edULL, 0x54768c4b0c64ca6eULL,
+	0xcb7ddcdda26da268ULL, 0xa9942f5dcf7dfd09ULL,
+	0xfe5d54150b090b02ULL, 0xd3f93b35435d7c4cULL,
+	0x9efa548d26e5a6e1ULL, 0xc47bc5014a1a6dafULL,
+	0xc6b8e9b0709f109aULL, 0x359ab6419ca1091bULL,
+	0xf867241c8cc6d4c0ULL, 0xc30163d203c94b62ULL,
+	0x9b407691d7fc44f8ULL, 0x79e0de63425dcf1dULL,
+	0xc21094364dfb5636ULL, 0x985915fc12f542e4ULL,
+	0xf294b943e17a2bc4ULL, 0x3e6f5b7b17b2939dULL,
+	0x979cf3ca6cec5b5aULL, 0xa705992ceecf9c42ULL,
+	0xbd8430bd08277231ULL, 0x50c6ff782a838353ULL,
+	0xece53cec4a314ebdULL, 0xa4f8bf5635246428ULL,
+	0x940f4613ae5ed136ULL, 0x871b7795e136be99ULL,
+	0xb913179899f68584ULL, 0x28e2557b59846e3fULL,
+	0xe757dd7ec07426e5ULL, 0x331aeada2fe589cfULL,
+	0x9096ea6f3848984fULL, 0x3ff0d2c85def7621ULL,
+	0xb4bca50b065abe63ULL, 0x0fed077a756b53a9ULL,
+	0xe1ebce4dc7f16dfbULL, 0xd3e8495912c62894ULL,
+	0x8d3360f09cf6e4bdULL, 0x64712dd7abbbd95cULL,
+	0xb080392cc4349decULL, 0xbd8d794d96aacfb3ULL,
+	0xdca04777f541c567ULL, 0xecf0d7a0fc5583a0ULL,
+	0x89e42caaf9491b60ULL, 0xf41686c49db57244ULL,
+	0xac5d37d5b79b6239ULL, 0x311c2875c522ced5ULL,
+	0xd77485cb25823ac7ULL, 0x7d633293366b828bULL,
+	0x86a8d39ef77164bcULL, 0xae5dff9c02033197ULL,
+	0xa8530886b54dbdebULL, 0xd9f57f830283fdfcULL,
+	0xd267caa862a12d66ULL, 0xd072df63c324fd7bULL,
+	0x8380dea93da4bc60ULL, 0x4247cb9e59f71e6dULL,
+	0xa46116538d0deb78ULL, 0x52d9be85f074e608ULL,
+	0xcd795be870516656ULL, 0x67902e276c921f8bULL,
+	0x806bd9714632dff6ULL, 0x00ba1cd8a3db53b6ULL,
+	0xa086cfcd97bf97f3ULL, 0x80e8a40eccd228a4ULL,
+	0xc8a883c0fdaf7df0ULL, 0x6122cd128006b2cdULL,
+	0xfad2a4b13d1b5d6cULL, 0x796b805720085f81ULL,
+	0x9cc3a6eec6311a63ULL, 0xcbe3303674053bb0ULL,
+	0xc3f490aa77bd60fcULL, 0xbedbfc4411068a9cULL,
+	0xf4f1b4d515acb93bULL, 0xee92fb5515482d44ULL,
+	0x991711052d8bf3c5ULL, 0x751bdd152d4d1c4aULL,
+	0xbf5cd54678eef0b6ULL, 0xd262d45a78a0635dULL,
+	0xef340a98172aace4ULL, 0x86fb897116c87c34ULL,
+	0x9580869f0e7aac0eULL, 0xd45d35e6ae3d4da0ULL,
+	0xbae0a846d2195712ULL, 0x8974836059cca109ULL,
+	0xe998d258869facd7ULL, 0x2bd1a438703fc94bULL,
+	0x91ff83775423cc06ULL, 0x7b6306a34627ddcfULL,
+	0xb67f6455292cbf08ULL, 0x1a3bc84c17b1d542ULL,
+	0xe41f3d6a7377eecaULL, 0x20caba5f1d9e4a93ULL,
+	0x8e938662882af53eULL, 0x547eb47b7282ee9cULL,
+	0xb23867fb2a35b28dULL, 0xe99e619a4f23aa43ULL,
+	0xdec681f9f4c31f31ULL, 0x6405fa00e2ec94d4ULL,
+	0x8b3c113c38f9f37eULL, 0xde83bc408dd3dd04ULL,
+	0xae0b158b4738705eULL, 0x9624ab50b148d445ULL,
+	0xd98ddaee19068c76ULL, 0x3badd624dd9b0957ULL,
+	0x87f8a8d4cfa417c9ULL, 0xe54ca5d70a80e5d6ULL,
+	0xa9f6d30a038d1dbcULL, 0x5e9fcf4ccd211f4cULL,
+	0xd47487cc8470652bULL, 0x7647c3200069671fULL,
+	0x84c8d4dfd2c63f3bULL, 0x29ecd9f40041e073ULL,
+	0xa5fb0a17c777cf09ULL, 0xf468107100525890ULL,
+	0xcf79cc9db955c2ccULL, 0x7182148d4066eeb4ULL,
+	0x81ac1fe293d599bfULL, 0xc6f14cd848405530ULL,
+	0xa21727db38cb002fULL, 0xb8ada00e5a506a7cULL,
+	0xca9cf1d206fdc03bULL, 0xa6d90811f0e4851cULL,
+	0xfd442e4688bd304aULL, 0x908f4a166d1da663ULL,
+	0x9e4a9cec15763e2eULL, 0x9a598e4e043287feULL,
+	0xc5dd44271ad3cdbaULL, 0x40eff1e1853f29fdULL,
+	0xf7549530e188c128ULL, 0xd12bee59e68ef47cULL,
+	0x9a94dd3e8cf578b9ULL, 0x82bb74f8301958ceULL,
+	0xc13a148e3032d6e7ULL, 0xe36a52363c1faf01ULL,
+	0xf18899b1bc3f8ca1ULL, 0xdc44e6c3cb279ac1ULL,
+	0x96f5600f15a7b7e5ULL, 0x29ab103a5ef8c0b9ULL,
+	0xbcb2b812db11a5deULL, 0x7415d448f6b6f0e7ULL,
+	0xebdf661791d60f56ULL, 0x111b495b3464ad21ULL,
+	0x936b9fcebb25c995ULL, 0xcab10dd900beec34ULL,
+	0xb84687c269ef3bfbULL, 0x3d5d514f40eea742ULL,
+	0xe65829b3046b0afaULL, 0x0cb4a5a3112a5112ULL,
+	0x8ff71a0fe2c2e6dcULL, 0x47f0e785eaba72abULL,
+	0xb3f4e093db73a093ULL, 0x59ed216765690f56ULL,
+	0xe0f218b8d25088b8ULL, 0x306869c13ec3532cULL,
+	0x8c974f7383725573ULL, 0x1e414218c73a13fbULL,
+	0xafbd2350644eeacfULL, 0xe5d1929ef90898faULL,
+	0xdbac6c247d62a583ULL, 0xdf45f746b74abf39ULL,
+	0x894bc396ce5da772ULL, 0x6b8bba8c328eb783ULL,
+	0xab9eb47c81f5114fULL, 0x066ea92f3f326564ULL,
+	0xd686619ba27255a2ULL, 0xc80a537b0efefebdULL,
+	0x8613fd0145877585ULL, 0xbd06742ce95f5f36ULL,
+	0xa798fc4196e952e7ULL, 0x2c48113823b73704ULL,
+	0xd17f3b51fca3a7a0ULL, 0xf75a15862ca504c5ULL,
+	0x82ef85133de648c4ULL, 0x9a984d73dbe722fbULL,
+	0xa3ab66580d5fdaf5ULL, 0xc13e60d0d2e0ebbaULL,
+	0xcc963fee10b7d1b3ULL, 0x318df905079926a8ULL,
+	0xffbbcfe994e5c61fULL, 0xfdf17746497f7052ULL,
+	0x9fd561f1fd0f9bd3ULL, 0xfeb6ea8bedefa633ULL,
+	0xc7caba6e7c5382c8ULL, 0xfe64a52ee96b8fc0ULL,
+	0xf9bd690a1b68637bULL, 0x3dfdce7aa3c673b0ULL,
+	0x9c1661a651213e2dULL, 0x06bea10ca65c084eULL,
+	0xc31bfa0fe5698db8ULL, 0x486e494fcff30a62ULL,
+	0xf3e2f893dec3f126ULL, 0x5a89dba3c3efccfaULL,
+	0x986ddb5c6b3a76b7ULL, 0xf89629465a75e01cULL,
+	0xbe89523386091465ULL, 0xf6bbb397f1135823ULL,
+	0xee2ba6c0678b597fULL, 0x746aa07ded582e2cULL,
+	0x94db483840b717efULL, 0xa8c2a44eb4571cdcULL,
+	0xba121a4650e4ddebULL, 0x92f34d62616ce413ULL,
+	0xe896a0d7e51e1566ULL, 0x77b020baf9c81d17ULL,
+	0x915e2486ef32cd60ULL, 0x0ace1474dc1d122eULL,
+	0xb5b5ada8aaff80b8ULL, 0x0d819992132456baULL,
+	0xe3231912d5bf60e6ULL, 0x10e1fff697ed6c69ULL,
+	0x8df5efabc5979c8fULL, 0xca8d3ffa1ef463c1ULL,
+	0xb1736b96b6fd83b3ULL, 0xbd308ff8a6b17cb2ULL,
+	0xddd0467c64bce4a0ULL, 0xac7cb3f6d05ddbdeULL,
+	0x8aa22c0dbef60ee4ULL, 0x6bcdf07a423aa96bULL,
+	0xad4ab7112eb3929dULL, 0x86c16c98d2c953c6ULL,
+	0xd89d64d57a607744ULL, 0xe871c7bf077ba8b7ULL,
+	0x87625f056c7c4a8bULL, 0x11471cd764ad4972ULL,
+	0xa93af6c6c79b5d2dULL, 0xd598e40d3dd89bcfULL,
+	0xd389b47879823479ULL, 0x4aff1d108d4ec2c3ULL,
+	0x843610cb4bf160cbULL, 0xcedf722a585139baULL,
+	0xa54394fe1eedb8feULL, 0xc2974eb4ee658828ULL,
+	0xce947a3da6a9273eULL, 0x733d226229feea32ULL,
+	0x811ccc668829b887ULL, 0x0806357d5a3f525fULL,
+	0xa163ff802a3426a8ULL, 0xca07c2dcb0cf26f7ULL,
+	0xc9bcff6034c13052ULL, 0xfc89b393dd02f0b5ULL,
+	0xfc2c3f3841f17c67ULL, 0xbbac2078d443ace2ULL,
+	0x9d9ba7832936edc0ULL, 0xd54b944b84aa4c0dULL,
+	0xc5029163f384a931ULL, 0x0a9e795e65d4df11ULL,
+	0xf64335bcf065d37dULL, 0x4d4617b5ff4a16d5ULL,
+	0x99ea0196163fa42eULL, 0x504bced1bf8e4e45ULL,
+	0xc06481fb9bcf8d39ULL, 0xe45ec2862f71e1d6ULL,
+	0xf07da27a82c37088ULL, 0x5d767327bb4e5a4cULL,
+	0x964e858c91ba2655ULL, 0x3a6a07f8d510f86fULL,
+	0xbbe226efb628afeaULL, 0x890489f70a55368bULL,
+	0xeadab0aba3b2dbe5ULL, 0x2b45ac74ccea842eULL,
+	0x92c8ae6b464fc96fULL, 0x3b0b8bc90012929dULL,
+	0xb77ada0617e3bbcbULL, 0x09ce6ebb40173744ULL,
+	0xe55990879ddcaabdULL, 0xcc420a6a101d0515ULL,
+	0x8f57fa54c2a9eab6ULL, 0x9fa946824a12232dULL,
+	0xb32df8e9f3546564ULL, 0x47939822dc96abf9ULL,
+	0xdff9772470297ebdULL, 0x59787e2b93bc56f7ULL,
+	0x8bfbea76c619ef36ULL, 0x57eb4edb3c55b65aULL,
+	0xaefae51477a06b03ULL, 0xede622920b6b23f1ULL,
+	0xdab99e59958885c4ULL, 0xe95fab368e45ecedULL,
+	0x88b402f7fd75539bULL, 0x11dbcb0218ebb414ULL,
+	0xaae103b5fcd2a881ULL, 0xd652bdc29f26a119ULL,
+	0xd59944a37c0752a2ULL, 0x4be76d3346f0495fULL,
+	0x857fcae62d8493a5ULL, 0x6f70a4400c562ddbULL,
+	0xa6dfbd9fb8e5b88eULL, 0xcb4ccd500f6bb952ULL,
+	0xd097ad07a71f26b2ULL, 0x7e2000a41346a7a7ULL,
+	0x825ecc24c873782fULL, 0x8ed400668c0c28c8ULL,
+	0xa2f67f2dfa90563bULL, 0x728900802f0f32faULL,
+	0xcbb41ef979346bcaULL, 0x4f2b40a03ad2ffb9ULL,
+	0xfea126b7d78186bcULL, 0xe2f610c84987bfa8ULL,
+	0x9f24b832e6b0f436ULL, 0x0dd9ca7d2df4d7c9ULL,
+	0xc6ede63fa05d3143ULL, 0x91503d1c79720dbbULL,
+	0xf8a95fcf88747d94ULL, 0x75a44c6397ce912aULL,
+	0x9b69dbe1b548ce7cULL, 0xc986afbe3ee11abaULL,
+	0xc24452da229b021bULL, 0xfbe85badce996168ULL,
+	0xf2d56790ab41c2a2ULL, 0xfae27299423fb9c3ULL,
+	0x97c560ba6b0919a5ULL, 0xdccd879fc967d41aULL,
+	0xbdb6b8e905cb600fULL, 0x5400e987bbc1c920ULL,
+	0xed246723473e3813ULL, 0x290123e9aab23b68ULL,
+	0x9436c0760c86e30bULL, 0xf9a0b6720aaf6521ULL,
+	0xb94470938fa89bceULL, 0xf808e40e8d5b3e69ULL,
+	0xe7958cb87392c2c2ULL, 0xb60b1d1230b20e04ULL,
+	0x90bd77f3483bb9b9ULL, 0xb1c6f22b5e6f48c2ULL,
+	0xb4ecd5f01a4aa828ULL, 0x1e38aeb6360b1af3ULL,
+	0xe2280b6c20dd5232ULL, 0x25c6da63c38de1b0ULL,
+	0x8d590723948a535fULL, 0x579c487e5a38ad0eULL,
+	0xb0af48ec79ace837ULL, 0x2d835a9df0c6d851ULL,
+	0xdcdb1b2798182244ULL, 0xf8e431456cf88e65ULL,
+	0x8a08f0f8bf0f156bULL, 0x1b8e9ecb641b58ffULL,
+	0xac8b2d36eed2dac5ULL, 0xe272467e3d222f3fULL,
+	0xd7adf884aa879177ULL, 0x5b0ed81dcc6abb0fULL,
+	0x86ccbb52ea94baeaULL, 0x98e947129fc2b4e9ULL,
+	0xa87fea27a539e9a5ULL, 0x3f2398d747b36224ULL,
+	0xd29fe4b18e88640eULL, 0x8eec7f0d19a03aadULL,
+	0x83a3eeeef9153e89ULL, 0x1953cf68300424acULL,
+	0xa48ceaaab75a8e2bULL, 0x5fa8c3423c052dd7ULL,
+	0xcdb02555653131b6ULL, 0x3792f412cb06794dULL,
+	0x808e17555f3ebf11ULL, 0xe2bbd88bbee40bd0ULL,
+	0xa0b19d2ab70e6ed6ULL, 0x5b6aceaeae9d0ec4ULL,
+	0xc8de047564d20a8bULL, 0xf245825a5a445275ULL,
+	0xfb158592be068d2eULL, 0xeed6e2f0f0d56712ULL,
+	0x9ced737bb6c4183dULL, 0x55464dd69685606bULL,
+	0xc428d05aa4751e4cULL, 0xaa97e14c3c26b886ULL,
+	0xf53304714d9265dfULL, 0xd53dd99f4b3066a8ULL,
+	0x993fe2c6d07b7fabULL, 0xe546a8038efe4029ULL,
+	0xbf8fdb78849a5f96ULL, 0xde98520472bdd033ULL,
+	0xef73d256a5c0f77cULL, 0x963e66858f6d4440ULL,
+	0x95a8637627989aadULL, 0xdde7001379a44aa8ULL,
+	0xbb127c53b17ec159ULL, 0x5560c018580d5d52ULL,
+	0xe9d71b689dde71afULL, 0xaab8f01e6e10b4a6ULL,
+	0x9226712162ab070dULL, 0xcab3961304ca70e8ULL,
+	0xb6b00d69bb55c8d1ULL, 0x3d607b97c5fd0d22ULL,
+	0xe45c10c42a2b3b05ULL, 0x8cb89a7db77c506aULL,
+	0x8eb98a7a9a5b04e3ULL, 0x77f3608e92adb242ULL,
+	0xb267ed1940f1c61cULL, 0x55f038b237591ed3ULL,
+	0xdf01e85f912e37a3ULL, 0x6b6c46dec52f6688ULL,
+	0x8b61313bbabce2c6ULL, 0x2323ac4b3b3da015ULL,
+	0xae397d8aa96c1b77ULL, 0xabec975e0a0d081aULL,
+	0xd9c7dced53c72255ULL, 0x96e7bd358c904a21ULL,
+	0x881cea14545c7575ULL, 0x7e50d64177da2e54ULL,
+	0xaa242499697392d2ULL, 0xdde50bd1d5d0b9e9ULL,
+	0xd4ad2dbfc3d07787ULL, 0x955e4ec64b44e864ULL,
+	0x84ec3c97da624ab4ULL, 0xbd5af13bef0b113eULL,
+	0xa6274bbdd0fadd61ULL, 0xecb1ad8aeacdd58eULL,
+	0xcfb11ead453994baULL, 0x67de18eda5814af2ULL,
+	0x81ceb32c4b43fcf4ULL, 0x80eacf948770ced7ULL,
+	0xa2425ff75e14fc31ULL, 0xa1258379a94d028dULL,
+	0xcad2f7f5359a3b3eULL, 0x096ee45813a04330ULL,
+	0xfd87b5f28300ca0dULL, 0x8bca9d6e188853fcULL,
+	0x9e74d1b791e07e48ULL, 0x775ea264cf55347eULL,
+	0xc612062576589ddaULL, 0x95364afe032a819eULL,
+	0xf79687aed3eec551ULL, 0x3a83ddbd83f52205ULL,
+	0x9abe14cd44753b52ULL, 0xc4926a9672793543ULL,
+	0xc16d9a0095928a27ULL, 0x75b7053c0f178294ULL,
+	0xf1c90080baf72cb1ULL, 0x5324c68b12dd6339ULL,
+	0x971da05074da7beeULL, 0xd3f6fc16ebca5e04ULL,
+	0xbce5086492111aeaULL, 0x88f4bb1ca6bcf585ULL,
+	0xec1e4a7db69561a5ULL, 0x2b31e9e3d06c32e6ULL,
+	0x9392ee8e921d5d07ULL, 0x3aff322e62439fd0ULL,
+	0xb877aa3236a4b449ULL, 0x09befeb9fad487c3ULL,
+	0xe69594bec44de15bULL, 0x4c2ebe687989a9b4ULL,
+	0x901d7cf73ab0acd9ULL, 0x0f9d37014bf60a11ULL,
+	0xb424dc35095cd80fULL, 0x538484c19ef38c95ULL,
+	0xe12e13424bb40e13ULL, 0x2865a5f206b06fbaULL,
+	0x8cbccc096f5088cbULL, 0xf93f87b7442e45d4ULL,
+	0xafebff0bcb24aafeULL, 0xf78f69a51539d749ULL,
+	0xdbe6fecebdedd5beULL, 0xb573440e5a884d1cULL,
+	0x89705f4136b4a597ULL, 0x31680a88f8953031ULL,
+	0xabcc77118461cefcULL, 0xfdc20d2b36ba7c3eULL,
+	0xd6bf94d5e57a42bcULL, 0x3d32907604691b4dULL,
+	0x8637bd05af6c69b5ULL, 0xa63f9a49c2c1b110ULL,
+	0xa7c5ac471b478423ULL, 0x0fcf80dc33721d54ULL,
+	0xd1b71758e219652bULL, 0xd3c36113404ea4a9ULL,
+	0x83126e978d4fdf3bULL, 0x645a1cac083126eaULL,
+	0xa3d70a3d70a3d70aULL, 0x3d70a3d70a3d70a4ULL,
+	0xccccccccccccccccULL, 0xcccccccccccccccdULL,
+	0x8000000000000000ULL, 0x0000000000000000ULL,
+	0xa000000000000000ULL, 0x0000000000000000ULL,
+	0xc800000000000000ULL, 0x0000000000000000ULL,
+	0xfa00000000000000ULL, 0x0000000000000000ULL,
+	0x9c40000000000000ULL, 0x0000000000000000ULL,
+	0xc350000000000000ULL, 0x0000000000000000ULL,
+	0xf424000000000000ULL, 0x0000000000000000ULL,
+	0x9896800000000000ULL, 0x0000000000000000ULL,
+	0xbebc200000000000ULL, 0x0000000000000000ULL,
+	0xee6b280000000000ULL, 0x0000000000000000ULL,
+	0x9502f90000000000ULL, 0x0000000000000000ULL,
+	0xba43b74000000000ULL, 0x0000000000000000ULL,
+	0xe8d4a51000000000ULL, 0x0000000000000000ULL,
+	0x9184e72a00000000ULL, 0x0000000000000000ULL,
+	0xb5e620f480000000ULL, 0x0000000000000000ULL,
+	0xe35fa931a0000000ULL, 0x0000000000000000ULL,
+	0x8e1bc9bf04000000ULL, 0x0000000000000000ULL,
+	0xb1a2bc2ec5000000ULL, 0x0000000000000000ULL,
+	0xde0b6b3a76400000ULL, 0x0000000000000000ULL,
+	0x8ac7230489e80000ULL, 0x0000000000000000ULL,
+	0xad78ebc5ac620000ULL, 0x0000000000000000ULL,
+	0xd8d726b7177a8000ULL, 0x0000000000000000ULL,
+	0x878678326eac9000ULL, 0x0000000000000000ULL,
+	0xa968163f0a57b400ULL, 0x0000000000000000ULL,
+	0xd3c21bcecceda100ULL, 0x0000000000000000ULL,
+	0x84595161401484a0ULL, 0x0000000000000000ULL,
+	0xa56fa5b99019a5c8ULL, 0x0000000000000000ULL,
+	0xcecb8f27f4200f3aULL, 0x0000000000000000ULL,
+	0x813f3978f8940984ULL, 0x4000000000000000ULL,
+	0xa18f07d736b90be5ULL, 0x5000000000000000ULL,
+	0xc9f2c9cd04674edeULL, 0xa400000000000000ULL,
+	0xfc6f7c4045812296ULL, 0x4d00000000000000ULL,
+	0x9dc5ada82b70b59dULL, 0xf020000000000000ULL,
+	0xc5371912364ce305ULL, 0x6c28000000000000ULL,
+	0xf684df56c3e01bc6ULL, 0xc732000000000000ULL,
+	0x9a130b963a6c115cULL, 0x3c7f400000000000ULL,
+	0xc097ce7bc90715b3ULL, 0x4b9f100000000000ULL,
+	0xf0bdc21abb48db20ULL, 0x1e86d40000000000ULL,
+	0x96769950b50d88f4ULL, 0x1314448000000000ULL,
+	0xbc143fa4e250eb31ULL, 0x17d955a000000000ULL,
+	0xeb194f8e1ae525fdULL, 0x5dcfab0800000000ULL,
+	0x92efd1b8d0cf37beULL, 0x5aa1cae500000000ULL,
+	0xb7abc627050305adULL, 0xf14a3d9e40000000ULL,
+	0xe596b7b0c643c719ULL, 0x6d9ccd05d0000000ULL,
+	0x8f7e32ce7bea5c6fULL, 0xe4820023a2000000ULL,
+	0xb35dbf821ae4f38bULL, 0xdda2802c8a800000ULL,
+	0xe0352f62a19e306eULL, 0xd50b2037ad200000ULL,
+	0x8c213d9da502de45ULL, 0x4526f422cc340000ULL,
+	0xaf298d050e4395d6ULL, 0x9670b12b7f410000ULL,
+	0xdaf3f04651d47b4cULL, 0x3c0cdd765f114000ULL,
+	0x88d8762bf324cd0fULL, 0xa5880a69fb6ac800ULL,
+	0xab0e93b6efee0053ULL, 0x8eea0d047a457a00ULL,
+	0xd5d238a4abe98068ULL, 0x72a4904598d6d880ULL,
+	0x85a36366eb71f041ULL, 0x47a6da2b7f864750ULL,
+	0xa70c3c40a64e6c51ULL, 0x999090b65f67d924ULL,
+	0xd0cf4b50cfe20765ULL, 0xfff4b4e3f741cf6dULL,
+	0x82818f1281ed449fULL, 0xbff8f10e7a8921a4ULL,
+	0xa321f2d7226895c7ULL, 0xaff72d52192b6a0dULL,
+	0xcbea6f8ceb02bb39ULL, 0x9bf4f8a69f764490ULL,
+	0xfee50b7025c36a08ULL, 0x02f236d04753d5b4ULL,
+	0x9f4f2726179a2245ULL, 0x01d762422c946590ULL,
+	0xc722f0ef9d80aad6ULL, 0x424d3ad2b7b97ef5ULL,
+	0xf8ebad2b84e0d58bULL, 0xd2e0898765a7deb2ULL,
+	0x9b934c3b330c8577ULL, 0x63cc55f49f88eb2fULL,
+	0xc2781f49ffcfa6d5ULL, 0x3cbf6b71c76b25fbULL,
+	0xf316271c7fc3908aULL, 0x8bef464e3945ef7aULL,
+	0x97edd871cfda3a56ULL, 0x97758bf0e3cbb5acULL,
+	0xbde94e8e43d0c8ecULL, 0x3d52eeed1cbea317ULL,
+	0xed63a231d4c4fb27ULL, 0x4ca7aaa863ee4bddULL,
+	0x945e455f24fb1cf8ULL, 0x8fe8caa93e74ef6aULL,
+	0xb975d6b6ee39e436ULL, 0xb3e2fd538e122b44ULL,
+	0xe7d34c64a9c85d44ULL, 0x60dbbca87196b616ULL,
+	0x90e40fbeea1d3a4aULL, 0xbc8955e946fe31cdULL,
+	0xb51d13aea4a488ddULL, 0x6babab6398bdbe41ULL,
+	0xe264589a4dcdab14ULL, 0xc696963c7eed2dd1ULL,
+	0x8d7eb76070a08aecULL, 0xfc1e1de5cf543ca2ULL,
+	0xb0de65388cc8ada8ULL, 0x3b25a55f43294bcbULL,
+	0xdd15fe86affad912ULL, 0x49ef0eb713f39ebeULL,
+	0x8a2dbf142dfcc7abULL, 0x6e3569326c784337ULL,
+	0xacb92ed9397bf996ULL, 0x49c2c37f07965404ULL,
+	0xd7e77a8f87daf7fbULL, 0xdc33745ec97be906ULL,
+	0x86f0ac99b4e8dafdULL, 0x69a028bb3ded71a3ULL,
+	0xa8acd7c0222311bcULL, 0xc40832ea0d68ce0cULL,
+	0xd2d80db02aabd62bULL, 0xf50a3fa490c30190ULL,
+	0x83c7088e1aab65dbULL, 0x792667c6da79e0faULL,
+	0xa4b8cab1a1563f52ULL, 0x577001b891185938ULL,
+	0xcde6fd5e09abcf26ULL, 0xed4c0226b55e6f86ULL,
+	0x80b05e5ac60b6178ULL, 0x544f8158315b05b4ULL,
+	0xa0dc75f1778e39d6ULL, 0x696361ae3db1c721ULL,
+	0xc913936dd571c84cULL, 0x03bc3a19cd1e38e9ULL,
+	0xfb5878494ace3a5fULL, 0x04ab48a04065c723ULL,
+	0x9d174b2dcec0e47bULL, 0x62eb0d64283f9c76ULL,
+	0xc45d1df942711d9aULL, 0x3ba5d0bd324f8394ULL,
+	0xf5746577930d6500ULL, 0xca8f44ec7ee36479ULL,
+	0x9968bf6abbe85f20ULL, 0x7e998b13cf4e1ecbULL,
+	0xbfc2ef456ae276e8ULL, 0x9e3fedd8c321a67eULL,
+	0xefb3ab16c59b14a2ULL, 0xc5cfe94ef3ea101eULL,
+	0x95d04aee3b80ece5ULL, 0xbba1f1d158724a12ULL,
+	0xbb445da9ca61281fULL, 0x2a8a6e45ae8edc97ULL,
+	0xea1575143cf97226ULL, 0xf52d09d71a3293bdULL,
+	0x924d692ca61be758ULL, 0x593c2626705f9c56ULL,
+	0xb6e0c377cfa2e12eULL, 0x6f8b2fb00c77836cULL,
+	0xe498f455c38b997aULL, 0x0b6dfb9c0f956447ULL,
+	0x8edf98b59a373fecULL, 0x4724bd4189bd5eacULL,
+	0xb2977ee300c50fe7ULL, 0x58edec91ec2cb657ULL,
+	0xdf3d5e9bc0f653e1ULL, 0x2f2967b66737e3edULL,
+	0x8b865b215899f46cULL, 0xbd79e0d20082ee74ULL,
+	0xae67f1e9aec07187ULL, 0xecd8590680a3aa11ULL,
+	0xda01ee641a708de9ULL, 0xe80e6f4820cc9495ULL,
+	0x884134fe908658b2ULL, 0x3109058d147fdcddULL,
+	0xaa51823e34a7eedeULL, 0xbd4b46f0599fd415ULL,
+	0xd4e5e2cdc1d1ea96ULL, 0x6c9e18ac7007c91aULL,
+	0x850fadc09923329eULL, 0x03e2cf6bc604ddb0ULL,
+	0xa6539930bf6bff45ULL, 0x84db8346b786151cULL,
+	0xcfe87f7cef46ff16ULL, 0xe612641865679a63ULL,
+	0x81f14fae158c5f6eULL, 0x4fcb7e8f3f60c07eULL,
+	0xa26da3999aef7749ULL, 0xe3be5e330f38f09dULL,
+	0xcb090c8001ab551cULL, 0x5cadf5bfd3072cc5ULL,
+	0xfdcb4fa002162a63ULL, 0x73d9732fc7c8f7f6ULL,
+	0x9e9f11c4014dda7eULL, 0x2867e7fddcdd9afaULL,
+	0xc646d63501a1511dULL, 0xb281e1fd541501b8ULL,
+	0xf7d88bc24209a565ULL, 0x1f225a7ca91a4226ULL,
+	0x9ae757596946075fULL, 0x3375788de9b06958ULL,
+	0xc1a12d2fc3978937ULL, 0x0052d6b1641c83aeULL,
+	0xf209787bb47d6b84ULL, 0xc0678c5dbd23a49aULL,
+	0x9745eb4d50ce6332ULL, 0xf840b7ba963646e0ULL,
+	0xbd176620a501fbffULL, 0xb650e5a93bc3d898ULL,
+	0xec5d3fa8ce427affULL, 0xa3e51f138ab4cebeULL,
+	0x93ba47c980e98cdfULL, 0xc66f336c36b10137ULL,
+	0xb8a8d9bbe123f017ULL, 0xb80b0047445d4184ULL,
+	0xe6d3102ad96cec1dULL, 0xa60dc059157491e5ULL,
+	0x9043ea1ac7e41392ULL, 0x87c89837ad68db2fULL,
+	0xb454e4a179dd1877ULL, 0x29babe4598c311fbULL,
+	0xe16a1dc9d8545e94ULL, 0xf4296dd6fef3d67aULL,
+	0x8ce2529e2734bb1dULL, 0x1899e4a65f58660cULL,
+	0xb01ae745b101e9e4ULL, 0x5ec05dcff72e7f8fULL,
+	0xdc21a1171d42645dULL, 0x76707543f4fa1f73ULL,
+	0x899504ae72497ebaULL, 0x6a06494a791c53a8ULL,
+	0xabfa45da0edbde69ULL, 0x0487db9d17636892ULL,
+	0xd6f8d7509292d603ULL, 0x45a9d2845d3c42b6ULL,
+	0x865b86925b9bc5c2ULL, 0x0b8a2392ba45a9b2ULL,
+	0xa7f26836f282b732ULL, 0x8e6cac7768d7141eULL,
+	0xd1ef0244af2364ffULL, 0x3207d795430cd926ULL,
+	0x8335616aed761f1fULL, 0x7f44e6bd49e807b8ULL,
+	0xa402b9c5a8d3a6e7ULL, 0x5f16206c9c6209a6ULL,
+	0xcd036837130890a1ULL, 0x36dba887c37a8c0fULL,
+	0x802221226be55a64ULL, 0xc2494954da2c9789ULL,
+	0xa02aa96b06deb0fdULL, 0xf2db9baa10b7bd6cULL,
+	0xc83553c5c8965d3dULL, 0x6f92829494e5acc7ULL,
+	0xfa42a8b73abbf48cULL, 0xcb772339ba1f17f9ULL,
+	0x9c69a97284b578d7ULL, 0xff2a760414536efbULL,
+	0xc38413cf25e2d70dULL, 0xfef5138519684abaULL,
+	0xf46518c2ef5b8cd1ULL, 0x7eb258665fc25d69ULL,
+	0x98bf2f79d5993802ULL, 0xef2f773ffbd97a61ULL,
+	0xbeeefb584aff8603ULL, 0xaafb550ffacfd8faULL,
+	0xeeaaba2e5dbf6784ULL, 0x95ba2a53f983cf38ULL,
+	0x952ab45cfa97a0b2ULL, 0xdd945a747bf26183ULL,
+	0xba756174393d88dfULL, 0x94f971119aeef9e4ULL,
+	0xe912b9d1478ceb17ULL, 0x7a37cd5601aab85dULL,
+	0x91abb422ccb812eeULL, 0xac62e055c10ab33aULL,
+	0xb616a12b7fe617aaULL, 0x577b986b314d6009ULL,
+	0xe39c49765fdf9d94ULL, 0xed5a7e85fda0b80bULL,
+	0x8e41ade9fbebc27dULL, 0x14588f13be847307ULL,
+	0xb1d219647ae6b31cULL, 0x596eb2d8ae258fc8ULL,
+	0xde469fbd99a05fe3ULL, 0x6fca5f8ed9aef3bbULL,
+	0x8aec23d680043beeULL, 0x25de7bb9480d5854ULL,
+	0xada72ccc20054ae9ULL, 0xaf561aa79a10ae6aULL,
+	0xd910f7ff28069da4ULL, 0x1b2ba1518094da04ULL,
+	0x87aa9aff79042286ULL, 0x90fb44d2f05d0842ULL,
+	0xa99541bf57452b28ULL, 0x353a1607ac744a53ULL,
+	0xd3fa922f2d1675f2ULL, 0x42889b8997915ce8ULL,
+	0x847c9b5d7c2e09b7ULL, 0x69956135febada11ULL,
+	0xa59bc234db398c25ULL, 0x43fab9837e699095ULL,
+	0xcf02b2c21207ef2eULL, 0x94f967e45e03f4bbULL,
+	0x8161afb94b44f57dULL, 0x1d1be0eebac278f5ULL,
+	0xa1ba1ba79e1632dcULL, 0x6462d92a69731732ULL,
+	0xca28a291859bbf93ULL, 0x7d7b8f7503cfdcfeULL,
+	0xfcb2cb35e702af78ULL, 0x5cda735244c3d43eULL,
+	0x9defbf01b061adabULL, 0x3a0888136afa64a7ULL,
+	0xc56baec21c7a1916ULL, 0x088aaa1845b8fdd0ULL,
+	0xf6c69a72a3989f5bULL, 0x8aad549e57273d45ULL,
+	0x9a3c2087a63f6399ULL, 0x36ac54e2f678864bULL,
+	0xc0cb28a98fcf3c7fULL, 0x84576a1bb416a7ddULL,
+	0xf0fdf2d3f3c30b9fULL, 0x656d44a2a11c51d5ULL,
+	0x969eb7c47859e743ULL, 0x9f644ae5a4b1b325ULL,
+	0xbc4665b596706114ULL, 0x873d5d9f0dde1feeULL,
+	0xeb57ff22fc0c7959ULL, 0xa90cb506d155a7eaULL,
+	0x9316ff75dd87cbd8ULL, 0x09a7f12442d588f2ULL,
+	0xb7dcbf5354e9beceULL, 0x0c11ed6d538aeb2fULL,
+	0xe5d3ef282a242e81ULL, 0x8f1668c8a86da5faULL,
+	0x8fa475791a569d10ULL, 0xf96e017d694487bcULL,
+	0xb38d92d760ec4455ULL, 0x37c981dcc395a9acULL,
+	0xe070f78d3927556aULL, 0x85bbe253f47b1417ULL,
+	0x8c469ab843b89562ULL, 0x93956d7478ccec8eULL,
+	0xaf58416654a6babbULL, 0x387ac8d1970027b2ULL,
+	0xdb2e51bfe9d0696aULL, 0x06997b05fcc0319eULL,
+	0x88fcf317f22241e2ULL, 0x441fece3bdf81f03ULL,
+	0xab3c2fddeeaad25aULL, 0xd527e81cad7626c3ULL,
+	0xd60b3bd56a5586f1ULL, 0x8a71e223d8d3b074ULL,
+	0x85c7056562757456ULL, 0xf6872d5667844e49ULL,
+	0xa738c6bebb12d16cULL, 0xb428f8ac016561dbULL,
+	0xd106f86e69d785c7ULL, 0xe13336d701beba52ULL,
+	0x82a45b450226b39cULL, 0xecc0024661173473ULL,
+	0xa34d721642b06084ULL, 0x27f002d7f95d0190ULL,
+	0xcc20ce9bd35c78a5ULL, 0x31ec038df7b441f4ULL,
+	0xff290242c83396ceULL, 0x7e67047175a15271ULL,
+	0x9f79a169bd203e41ULL, 0x0f0062c6e984d386ULL,
+	0xc75809c42c684dd1ULL, 0x52c07b78a3e60868ULL,
+	0xf92e0c3537826145ULL, 0xa7709a56ccdf8a82ULL,
+	0x9bbcc7a142b17ccbULL, 0x88a66076400bb691ULL,
+	0xc2abf989935ddbfeULL, 0x6acff893d00ea435ULL,
+	0xf356f7ebf83552feULL, 0x0583f6b8c4124d43ULL,
+	0x98165af37b2153deULL, 0xc3727a337a8b704aULL,
+	0xbe1bf1b059e9a8d6ULL, 0x744f18c0592e4c5cULL,
+	0xeda2ee1c7064130cULL, 0x1162def06f79df73ULL,
+	0x9485d4d1c63e8be7ULL, 0x8addcb5645ac2ba8ULL,
+	0xb9a74a0637ce2ee1ULL, 0x6d953e2bd7173692ULL,
+	0xe8111c87c5c1ba99ULL, 0xc8fa8db6ccdd0437ULL,
+	0x910ab1d4db9914a0ULL, 0x1d9c9892400a22a2ULL,
+	0xb54d5e4a127f59c8ULL, 0x2503beb6d00cab4bULL,
+	0xe2a0b5dc971f303aULL, 0x2e44ae64840fd61dULL,
+	0x8da471a9de737e24ULL, 0x5ceaecfed289e5d2ULL,
+	0xb10d8e1456105dadULL, 0x7425a83e872c5f47ULL,
+	0xdd50f1996b947518ULL, 0xd12f124e28f77719ULL,
+	0x8a5296ffe33cc92fULL, 0x82bd6b70d99aaa6fULL,
+	0xace73cbfdc0bfb7bULL, 0x636cc64d1001550bULL,
+	0xd8210befd30efa5aULL, 0x3c47f7e05401aa4eULL,
+	0x8714a775e3e95c78ULL, 0x65acfaec34810a71ULL,
+	0xa8d9d1535ce3b396ULL, 0x7f1839a741a14d0dULL,
+	0xd31045a8341ca07cULL, 0x1ede48111209a050ULL,
+	0x83ea2b892091e44dULL, 0x934aed0aab460432ULL,
+	0xa4e4b66b68b65d60ULL, 0xf81da84d5617853fULL,
+	0xce1de40642e3f4b9ULL, 0x36251260ab9d668eULL,
+	0x80d2ae83e9ce78f3ULL, 0xc1d72b7c6b426019ULL,
+	0xa1075a24e4421730ULL, 0xb24cf65b8612f81fULL,
+	0xc94930ae1d529cfcULL, 0xdee033f26797b627ULL,
+	0xfb9b7cd9a4a7443cULL, 0x169840ef017da3b1ULL,
+	0x9d412e0806e88aa5ULL, 0x8e1f289560ee864eULL,
+	0xc491798a08a2ad4eULL, 0xf1a6f2bab92a27e2ULL,
+	0xf5b5d7ec8acb58a2ULL, 0xae10af696774b1dbULL,
+	0x9991a6f3d6bf1765ULL, 0xacca6da1e0a8ef29ULL,
+	0xbff610b0cc6edd3fULL, 0x17fd090a58d32af3ULL,
+	0xeff394dcff8a948eULL, 0xddfc4b4cef07f5b0ULL,
+	0x95f83d0a1fb69cd9ULL, 0x4abdaf101564f98eULL,
+	0xbb764c4ca7a4440fULL, 0x9d6d1ad41abe37f1ULL,
+	0xea53df5fd18d5513ULL, 0x84c86189216dc5edULL,
+	0x92746b9be2f8552cULL, 0x32fd3cf5b4e49bb4ULL,
+	0xb7118682dbb66a77ULL, 0x3fbc8c33221dc2a1ULL,
+	0xe4d5e82392a40515ULL, 0x0fabaf3feaa5334aULL,
+	0x8f05b1163ba6832dULL, 0x29cb4d87f2a7400eULL,
+	0xb2c71d5bca9023f8ULL, 0x743e20e9ef511012ULL,
+	0xdf78e4b2bd342cf6ULL, 0x914da9246b255416ULL,
+	0x8bab8eefb6409c1aULL, 0x1ad089b6c2f7548eULL,
+	0xae9672aba3d0c320ULL, 0xa184ac2473b529b1ULL,
+	0xda3c0f568cc4f3e8ULL, 0xc9e5d72d90a2741eULL,
+	0x8865899617fb1871ULL, 0x7e2fa67c7a658892ULL,
+	0xaa7eebfb9df9de8dULL, 0xddbb901b98feeab7ULL,
+	0xd51ea6fa85785631ULL, 0x552a74227f3ea565ULL,
+	0x8533285c936b35deULL, 0xd53a88958f87275fULL,
+	0xa67ff273b8460356ULL, 0x8a892abaf368f137ULL,
+	0xd01fef10a657842cULL, 0x2d2b7569b0432d85ULL,
+	0x8213f56a67f6b29bULL, 0x9c3b29620e29fc73ULL,
+	0xa298f2c501f45f42ULL, 0x8349f3ba91b47b8fULL,
+	0xcb3f2f7642717713ULL, 0x241c70a936219a73ULL,
+	0xfe0efb53d30dd4d7ULL, 0xed238cd383aa0110ULL,
+	0x9ec95d1463e8a506ULL, 0xf4363804324a40aaULL,
+	0xc67bb4597ce2ce48ULL, 0xb143c6053edcd0d5ULL,
+	0xf81aa16fdc1b81daULL, 0xdd94b7868e94050aULL,
+	0x9b10a4e5e9913128ULL, 0xca7cf2b4191c8326ULL,
+	0xc1d4ce1f63f57d72ULL, 0xfd1c2f611f63a3f0ULL,
+	0xf24a01a73cf2dccfULL, 0xbc633b39673c8cecULL,
+	0x976e41088617ca01ULL, 0xd5be0503e085d813ULL,
+	0xbd49d14aa79dbc82ULL, 0x4b2d8644d8a74e18ULL,
+	0xec9c459d51852ba2ULL, 0xddf8e7d60ed1219eULL,
+	0x93e1ab8252f33b45ULL, 0xcabb90e5c942b503ULL,
+	0xb8da1662e7b00a17ULL, 0x3d6a751f3b936243ULL,
+	0xe7109bfba19c0c9dULL, 0x0cc512670a783ad4ULL,
+	0x906a617d450187e2ULL, 0x27fb2b80668b24c5ULL,
+	0xb484f9dc9641e9daULL, 0xb1f9f660802dedf6ULL,
+	0xe1a63853bbd26451ULL, 0x5e7873f8a0396973ULL,
+	0x8d07e33455637eb2ULL, 0xdb0b487b6423e1e8ULL,
+	0xb049dc016abc5e5fULL, 0x91ce1a9a3d2cda62ULL,
+	0xdc5c5301c56b75f7ULL, 0x7641a140cc7810fbULL,
+	0x89b9b3e11b6329baULL, 0xa9e904c87fcb0a9dULL,
+	0xac2820d9623bf429ULL, 0x546345fa9fbdcd44ULL,
+	0xd732290fbacaf133ULL, 0xa97c177947ad4095ULL,
+	0x867f59a9d4bed6c0ULL, 0x49ed8eabcccc485dULL,
+	0xa81f301449ee8c70ULL, 0x5c68f256bfff5a74ULL,
+	0xd226fc195c6a2f8cULL, 0x73832eec6fff3111ULL,
+	0x83585d8fd9c25db7ULL, 0xc831fd53c5ff7eabULL,
+	0xa42e74f3d032f525ULL, 0xba3e7ca8b77f5e55ULL,
+	0xcd3a1230c43fb26fULL, 0x28ce1bd2e55f35ebULL,
+	0x80444b5e7aa7cf85ULL, 0x7980d163cf5b81b3ULL,
+	0xa0555e361951c366ULL, 0xd7e105bcc332621fULL,
+	0xc86ab5c39fa63440ULL, 0x8dd9472bf3fefaa7ULL,
+	0xfa856334878fc150ULL, 0xb14f98f6f0feb951ULL,
+	0x9c935e00d4b9d8d2ULL, 0x6ed1bf9a569f33d3ULL,
+	0xc3b8358109e84f07ULL, 0x0a862f80ec4700c8ULL,
+	0xf4a642e14c6262c8ULL, 0xcd27bb612758c0faULL,
+	0x98e7e9cccfbd7dbdULL, 0x8038d51cb897789cULL,
+	0xbf21e44003acdd2cULL, 0xe0470a63e6bd56c3ULL,
+	0xeeea5d5004981478ULL, 0x1858ccfce06cac74ULL,
+	0x95527a5202df0ccbULL, 0x0f37801e0c43ebc8ULL,
+	0xbaa718e68396cffdULL, 0xd30560258f54e6baULL,
+	0xe950df20247c83fdULL, 0x47c6b82ef32a2069ULL,
+	0x91d28b7416cdd27eULL, 0x4cdc331d57fa5441ULL,
+	0xb6472e511c81471dULL, 0xe0133fe4adf8e952ULL,
+	0xe3d8f9e563a198e5ULL, 0x58180fddd97723a6ULL,
+	0x8e679c2f5e44ff8fULL, 0x570f09eaa7ea7648ULL,
+};
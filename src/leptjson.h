@@ -31,6 +31,27 @@ typedef struct lept_value lept_value;
 typedef struct lept_member lept_member;
 
 /* Json 值结构 */
+#ifdef LEPT_COMPACT
+/* 紧凑布局（64 位下 16 字节）：数组、对象的容量记于元素、成员存储之前， */
+/* 长度、元素数与成员数为 32 位，单个字符串、容器与原文均不超过 4GB */
+struct lept_value {
+	union {
+		lept_member* m;   /* object 对象类型 */
+		lept_value* e;    /* array 数组类型 */
+		char* s;          /* string 类型存储字符串 */
+		const char* json; /* 按需解析时尚未解码的原文，由库维护 */
+
+		double n; /* 双精度浮点数存储数字 */
+
+		/* 短字符串直接存储于值内，由库维护 */
+		char i[sizeof(double)];
+	} u;
+
+	unsigned int len;    /* 字符串长度、元素数、成员数或原文长度 */
+	unsigned char type;  /* Json 值类型 lept_type */
+	unsigned char flags; /* 内部标志（存储空间归属等），由库维护 */
+};
+#else
 struct lept_value {
 	union {
 		struct {
@@ -47,10 +68,20 @@ struct lept_value {
 		} s; /* string 类型存储字符串 */
 
 		double n; /* 双精度浮点数存储数字 */
+
+		/* 短字符串直接存储于值内，由库维护 */
+		char i[sizeof(void*) + 2 * sizeof(size_t)];
+
+		struct {
+			const char* json;
+			size_t len;
+		} l; /* 按需解析时尚未解码的原文，由库维护 */
 	} u;
 
-	lept_type type; /* Json 值类型 */
+	lept_type type;     /* Json 值类型 */
+	unsigned int flags; /* 内部标志（存储空间归属等），由库维护 */
 };
+#endif
 
 /* Json 对象基本元素类型 */
 struct lept_member {
@@ -72,8 +103,27 @@ struct lept_member {
 #define lept_value_init(v)     \
 	do {                       \
 		(v)->type = LEPT_NULL; \
+		(v)->flags = 0;        \
 	} while (0)
 
+/* 内存分配器，user 原样传给各函数 */
+/* realloc 的 p 可为 NULL；free 不会收到 NULL；分配失败的处理同 malloc */
+typedef struct {
+	void* (*alloc)(void* user, size_t size);
+	void* (*realloc)(void* user, void* p, size_t size);
+	void (*free)(void* user, void* p);
+	void* user;
+} lept_allocator;
+
+/* 内存池，按块分配，整体释放 */
+/* 只用于解析结果的存储，池内空间不能单独释放 */
+typedef struct lept_arena_chunk lept_arena_chunk;
+typedef struct {
+	lept_arena_chunk* head; /* 当前分配块及已用块链表 */
+	size_t chunk_size;      /* 常规块大小 */
+	lept_allocator alloc;   /* 块的分配器 */
+} lept_arena;
+
 /* Json 解析返回类型 */
 enum {
 	LEPT_PARSE_OK,                /* 成功解析 */
@@ -89,16 +139,148 @@ enum {
 	LEPT_PARSE_MISS_COMMA_OR_SQUARE_BRACKET, /* 数组未闭合 */
 	LEPT_PARSE_MISS_KEY,                     /* 缺少键值 */
 	LEPT_PARSE_MISS_COLON,                   /* 缺少中间 : */
-	LEPT_PARSE_MISS_COMMA_OR_CURLY_BRACKET   /* 对象未闭合 */
+	LEPT_PARSE_MISS_COMMA_OR_CURLY_BRACKET,  /* 对象未闭合 */
+	LEPT_PARSE_FILE_ERROR,                   /* 文件无法打开、读取或映射 */
+	LEPT_PARSE_STOPPED,                      /* 事件处理函数终止了解析 */
+	LEPT_PARSE_TOO_DEEP,                     /* 嵌套超过 LEPT_PARSE_MAX_DEPTH 层 */
+	LEPT_PARSE_TOO_LONG /* 紧凑布局下字符串、数组或对象的长度超过 32 位 */
 };
 
+/* 解析时数组、对象的最大嵌套层数，可在编译时定义 */
+#ifndef LEPT_PARSE_MAX_DEPTH
+#define LEPT_PARSE_MAX_DEPTH 1024
+#endif
+
 /* Json 解析函数 */
 int lept_parse(lept_value* v, const char* json);
 
-/* Json 生成函数 */
+/* 解析 [json, json + len)，输入无需以 '\0' 结尾，不会读取范围之外的内存 */
+int lept_parse_n(lept_value* v, const char* json, size_t len);
+
+/* 同 lept_parse_n，调用者保证 json + len 之后还有 LEPT_PARSE_PADDING 字节可读 */
+/* 填充区内容任意，解析只读取不使用，可让 SIMD 整块读取一直进行到输入末尾 */
+#define LEPT_PARSE_PADDING 64
+int lept_parse_padded(lept_value* v, const char* json, size_t len);
+
+/* 解析文件，支持的平台上以只读方式映射文件后直接解析，支持 4 GB 以上的文件 */
+/* 映射期间文件不应被截断；flags 为以下选项的组合 */
+#define LEPT_FILE_POPULATE 0x1   /* 映射时预先读入全部页面 */
+#define LEPT_FILE_HUGE_PAGES 0x2 /* 建议内核使用大页（若支持） */
+int lept_parse_file(lept_value* v, const char* path, unsigned int flags);
+
+/* 全局分配器，库内的字符串、数组、对象、键、解析栈与生成结果均由其分配 */
+/* a 被复制保存，为 NULL 时恢复 malloc、realloc、free */
+/* 存储由分配时的全局分配器释放，应在分配任何值之前设置，且不能并发设置 */
+void lept_set_allocator(const lept_allocator* a);
+const lept_allocator* lept_get_allocator(void);
+
+/* 推送式解析，输入可分为任意多块依次送入，解析状态跨块保存 */
+/* feed 返回 LEPT_PARSE_OK 或已发现的错误，出错后此后的输入被忽略 */
+/* finish 表示输入结束，返回值与结果 v 均与对整个输入调用 lept_parse 相同 */
+/* finish 之后解析器回到初始状态，可继续解析下一个文档 */
+typedef struct lept_push_parser lept_push_parser;
+lept_push_parser* lept_push_parser_new(void);
+
+/* 解析器自身、解析栈与跨块缓冲区由 a 分配，结果 v 仍由全局分配器分配 */
+lept_push_parser* lept_push_parser_new_allocator(const lept_allocator* a);
+int lept_push_parser_feed(lept_push_parser* pp, const char* chunk,
+                          size_t len);
+int lept_push_parser_finish(lept_push_parser* pp, lept_value* v);
+void lept_push_parser_free(lept_push_parser* pp);
+
+/* 可复用的解析器，解析栈在多次解析间保留（只增不减），避免每次解析的分配与扩容 */
+/* 适合连续解析大量小文档；结果 v 与对同一输入调用 lept_parse（_n）相同 */
+/* 同一解析器不能同时用于多个线程 */
+typedef struct lept_parser lept_parser;
+lept_parser* lept_parser_new(void);
+
+/* 解析器自身与解析栈由 a 分配，结果 v 仍由全局分配器分配 */
+lept_parser* lept_parser_new_allocator(const lept_allocator* a);
+int lept_parser_parse(lept_parser* p, lept_value* v, const char* json);
+int lept_parser_parse_n(lept_parser* p, lept_value* v, const char* json,
+                        size_t len);
+void lept_parser_free(lept_parser* p);
+
+/* 事件式解析 (SAX)，解析过程中依次调用处理函数，不构造 lept_value 树 */
+/* 处理函数返回 0 继续解析，返回非 0 时解析终止并返回 LEPT_PARSE_STOPPED */
+/* 未设置（为 NULL）的处理函数忽略对应事件 */
+/* 字符串与键以指针加长度给出，不保证以 '\0' 结尾，只在调用期间有效 */
+/* 结束事件给出数组元素数或对象成员数；出错前已发出的事件不会撤回 */
+typedef struct {
+	int (*on_null)(void* user);
+	int (*on_bool)(void* user, int b);
+	int (*on_number)(void* user, double n);
+	int (*on_string)(void* user, const char* s, size_t len);
+	int (*on_key)(void* user, const char* k, size_t klen);
+	int (*on_start_object)(void* user);
+	int (*on_end_object)(void* user, size_t size);
+	int (*on_start_array)(void* user);
+	int (*on_end_array)(void* user, size_t size);
+} lept_handler;
+int lept_parse_sax(const char* json, const lept_handler* h, void* user);
+
+/* 按需解析，只校验整个输入，字符串、数组与对象记录原文位置 */
+/* 首次通过访问接口读取时才解码该值，子数组、子对象与字符串仍按需解码 */
+/* 未访问的部分不分配任何空间；v 使用期间 json 须保持有效 */
+/* 首次读取会经 const 指针写入解码结果，多线程并发读取前须先调用 lept_load */
+int lept_parse_lazy(lept_value* v, const char* json);
+
+/* 解码 v 中全部按需解析的值，此后 v 不再引用 json，读取接口不再修改值 */
+void lept_load(lept_value* v);
+
+/* 原地解析，字符串与键在 json 缓冲区内解码并直接指向该缓冲区 */
+/* 解析会改写 json 的内容，v 使用期间 json 须保持有效 */
+int lept_parse_insitu(lept_value* v, char* json);
+
+/* 内存池初始化、分配与整体释放，chunk_size 为 0 时使用默认块大小 */
+/* 池中的块由 alloc 分配，为 NULL 时使用初始化时的全局分配器 */
+/* 配合 lept_parse_arena、lept_copy_arena 可让整个文档使用单独的分配器 */
+void lept_arena_init(lept_arena* a, size_t chunk_size);
+void lept_arena_init_allocator(lept_arena* a, size_t chunk_size,
+                               const lept_allocator* alloc);
+void* lept_arena_alloc(lept_arena* a, size_t size);
+void lept_arena_free(lept_arena* a);
+
+/* 键池，解析时相同的对象键共享同一份只读存储，可供多次解析共用 */
+/* 使用键池解析的值中，键在使用期间须保证键池有效 */
+typedef struct lept_keypool lept_keypool;
+lept_keypool* lept_keypool_new(void);
+size_t lept_keypool_size(const lept_keypool* kp); /* 不同键的个数 */
+void lept_keypool_free(lept_keypool* kp);
+
+/* 使用键池解析，对象的键取自 kp，其余同 lept_parse */
+int lept_parse_keypool(lept_value* v, const char* json, lept_keypool* kp);
+
+/* 使用内存池解析，字符串、数组、对象的存储全部分配于 a 中 */
+/* 未经修改的文档由 lept_arena_free 整体释放，无需逐个 lept_free */
+/* 修改时需扩容或释放的存储会先复制到堆上，此时应在释放池前 lept_free(v) */
+int lept_parse_arena(lept_value* v, const char* json, lept_arena* a);
+
+/* 深拷贝到内存池，整个子树的存储为池中一次连续分配 */
+/* 释放与修改规则同 lept_parse_arena 的结果 */
+void lept_copy_arena(lept_value* dst, const lept_value* src, lept_arena* a);
+
+/* Json 生成函数，结果由全局分配器分配 */
 char* lept_stringify(const lept_value* v, size_t* length);
 
+/* 流式生成，结果按不超过 LEPT_STRINGIFY_CHUNK_SIZE 的块依次交给 write */
+/* 写出函数返回 0 表示成功，返回非 0 时不再写出，返回 LEPT_STRINGIFY_WRITE_ERROR */
+/* 只占用一块大小的缓冲区，不生成完整的结果字符串 */
+typedef int (*lept_write_fn)(void* user, const char* s, size_t len);
+enum {
+	LEPT_STRINGIFY_OK,         /* 全部写出 */
+	LEPT_STRINGIFY_WRITE_ERROR /* 写出函数返回了非 0 */
+};
+int lept_stringify_to(const lept_value* v, lept_write_fn write, void* user);
+
+/* 生成到调用者提供的缓冲区，最多写入 size - 1 字节并以 '\0' 结尾 */
+/* 返回完整结果的长度（不含 '\0'），不小于 size 时结果被截断，同 snprintf */
+/* 直接生成到 buf，不分配内存 */
+size_t lept_stringify_buffer(const lept_value* v, char* buf, size_t size);
+
 /* 拷贝，移动，交换 */
+/* 拷贝为深拷贝，按源的容量一次分配，总开销与值的大小成线性 */
+/* 按需解析的值解码到副本中，副本不引用原文 */
 void lept_copy(lept_value* dst, const lept_value* src);
 void lept_move(lept_value* dst, lept_value* src);
 void lept_swap(lept_value* lhs, lept_value* rhs);
@@ -110,8 +292,14 @@ void lept_free(lept_value* v);
 lept_type lept_get_type(const lept_value* v);
 
 /* 判断值两 Json 对象相等 */
+/* 先逐层比较类型、标量与元素（成员）数，再深入子值，靠近根部的差异可提前返回 */
 int lept_is_equal(const lept_value* lhs, const lept_value* rhs);
 
+/* 结构散列，相等的值散列值相同；对象的散列与成员顺序无关 */
+/* 值内不缓存结果，去重等场景应由调用者保存文档的散列，散列相同时再比较 */
+/* 含重复键的对象不保证与 lept_is_equal 一致 */
+size_t lept_hash(const lept_value* v);
+
 /* Json 置空 */
 /* null 类型不存在构造问题 */
 #define lept_set_null(v) lept_free(v)
@@ -128,12 +316,18 @@ void lept_set_number(lept_value* v, double n);
 const char* lept_get_string(const lept_value* v);
 size_t lept_get_string_length(const lept_value* v);
 
-void lept_set_string(lept_value* v, const char* s, size_t len);
+/* 设置字符串、数组与对象的长度或容量超过上限（紧凑布局下为 32 位）时 */
+/* 返回 LEPT_PARSE_TOO_LONG 且不修改 v，成功时返回 LEPT_PARSE_OK */
+int lept_set_string(lept_value* v, const char* s, size_t len);
+
+/* 接管全局分配器分配的 s，不复制；要求 s[len] == '\0'，此后由 v 负责释放 */
+/* 返回 LEPT_PARSE_TOO_LONG 时 s 仍归调用者所有 */
+int lept_set_string_adopt(lept_value* v, char* s, size_t len);
 
 /* 数组 */
 
 /* 初始化 array 类型值 */
-void lept_set_array(lept_value* v, size_t capacity);
+int lept_set_array(lept_value* v, size_t capacity);
 
 /* 获取数组容量信息 */
 size_t lept_get_array_size(const lept_value* v);
@@ -141,30 +335,49 @@ size_t lept_get_array_capacity(const lept_value* v);
 
 /* 动态数组操作 */
 /* 扩张容量，降低容量以适应 size ，清空数组 */
-void lept_reserve_array(lept_value* v, size_t capacity);
+int lept_reserve_array(lept_value* v, size_t capacity);
 void lept_shrink_array(lept_value* v);
 void lept_clear_array(lept_value* v);
 
 /* 数组操作 */
 /* 获得数组，数组尾部插入删除，指定 index 插入删除 */
 const lept_value* lept_get_array_element(const lept_value* v, size_t index);
+/* 插入单个元素时 e 可以是 v 自身的元素 */
 void lept_pushback_array_element(lept_value* v, const lept_value* e);
 void lept_popback_array_element(lept_value* v);
 void lept_insert_array_element(lept_value* v, const lept_value* e,
                                size_t index);
+
+/* 移入元素，不做深拷贝，e 被置为 null */
+void lept_pushback_array_element_move(lept_value* v, lept_value* e);
+void lept_insert_array_element_move(lept_value* v, lept_value* e,
+                                    size_t index);
+
+/* 在尾部或 index 处加入 null 元素并返回，可直接在其上构造 */
+/* 返回的指针在数组下一次增删元素前有效 */
+lept_value* lept_emplace_back_array_element(lept_value* v);
+lept_value* lept_emplace_array_element(lept_value* v, size_t index);
+
+/* 批量复制或移入 e[0, count)，e 可以是 v 自身的一段元素 */
+void lept_append_array_range(lept_value* v, const lept_value* e,
+                             size_t count);
+void lept_insert_array_range(lept_value* v, const lept_value* e, size_t count,
+                             size_t index);
+void lept_insert_array_range_move(lept_value* v, lept_value* e, size_t count,
+                                  size_t index);
 void lept_erase_array_element(lept_value* v, size_t index, size_t count);
 
 /* Json 对象操作 */
 
 /* 初始化 Json 对象 */
-void lept_set_object(lept_value* v, size_t capacity);
+int lept_set_object(lept_value* v, size_t capacity);
 
 /* 获取 Json 对象数组容量信息 */
 size_t lept_get_object_size(const lept_value* v);
 size_t lept_get_object_capacity(const lept_value* v);
 
 /* 扩张容量，降低容量以适应 size ，清空数组 */
-void lept_reserve_object(lept_value* v, size_t capacity);
+int lept_reserve_object(lept_value* v, size_t capacity);
 void lept_shrink_object(lept_value* v);
 void lept_clear_object(lept_value* v);
 
@@ -184,11 +397,23 @@ int lept_remove_object_value_by_index(lept_value* v, size_t index);
 int lept_remove_object_value_by_key(lept_value* v, const char* key,
                                     size_t klen);
 
+/* key 与 s_v 可以位于 v 自身的成员中 */
 int lept_set_object_value_by_index(lept_value* v, size_t index,
                                    const lept_value* s_v);
 int lept_set_object_value_by_key(lept_value* v, const char* key, size_t klen,
                                  const lept_value* s_v);
 
+/* 移入值，不做深拷贝，s_v 被置为 null */
+int lept_set_object_value_by_index_move(lept_value* v, size_t index,
+                                        lept_value* s_v);
+int lept_set_object_value_by_key_move(lept_value* v, const char* key,
+                                      size_t klen, lept_value* s_v);
+
+/* 返回键为 key 的值，键不存在时加入值为 null 的成员，可直接在其上构造 */
+/* 返回的指针在对象下一次增删成员前有效 */
+lept_value* lept_emplace_object_value(lept_value* v, const char* key,
+                                      size_t klen);
+
 /* Json 对象中的查找 */
 size_t lept_find_object_index(const lept_value* v, const char* key,
                               size_t klen);
@@ -1,4 +1,5 @@
 #include "../src/leptjson.h"
+#include <math.h>
 #include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -96,6 +97,8 @@ static int test_pass = 0;
 		EXPECT_EQ_INT(LEPT_PARSE_OK, lept_parse(&v1, json1)); \
 		EXPECT_EQ_INT(LEPT_PARSE_OK, lept_parse(&v2, json2)); \
 		EXPECT_EQ_INT(equality, lept_is_equal(&v1, &v2));     \
+		EXPECT_EQ_INT(equality,                               \
+		              lept_hash(&v1) == lept_hash(&v2));      \
 		lept_free(&v1);                                       \
 		lept_free(&v2);                                       \
 	} while (0)
@@ -154,6 +157,46 @@ static void test_parse_number() {
 	TEST_NUMBER(-1.7976931348623157e+308, "-1.7976931348623157e+308");
 }
 
+/* 随机数字与 strtod 结果逐位比较，覆盖快速路径、截断尾数与非规格化数 */
+static void test_parse_number_random() {
+	static const char digits[] = "0123456789";
+	unsigned long seed = 1;
+	char json[64];
+	int i, j;
+
+	for (i = 0; i < 200000; i++) {
+		int nd, point, e;
+		size_t n = 0;
+		lept_value v;
+		double expect;
+
+		seed = seed * 1103515245UL + 12345UL;
+		nd = 1 + (int)((seed >> 8) % 24);
+		point = (int)((seed >> 16) % (nd + 1));
+		seed = seed * 1103515245UL + 12345UL;
+		e = (int)((seed >> 8) % 700) - 360;
+
+		if (seed & 0x10000)
+			json[n++] = '-';
+		for (j = 0; j < nd; j++) {
+			seed = seed * 1103515245UL + 12345UL;
+			json[n++] = digits[j == 0 ? 1 + (seed >> 8) % 9 : (seed >> 8) % 10];
+			if (j + 1 == point && j + 1 < nd)
+				json[n++] = '.';
+		}
+		n += sprintf(json + n, "e%d", e);
+
+		expect = strtod(json, NULL);
+		lept_value_init(&v);
+		if (expect == HUGE_VAL || expect == -HUGE_VAL)
+			EXPECT_EQ_INT(LEPT_PARSE_NUMBER_TOO_BIG, lept_parse(&v, json));
+		else {
+			EXPECT_EQ_INT(LEPT_PARSE_OK, lept_parse(&v, json));
+			EXPECT_TRUE(memcmp(&expect, &v.u.n, sizeof(double)) == 0);
+		}
+	}
+}
+
 static void test_parse_string() {
 	TEST_STRING("", "\"\"");
 	TEST_STRING("Hello", "\"Hello\"");
@@ -172,6 +215,44 @@ static void test_parse_string() {
 	            "\"\\ud834\\udd1e\""); /* G clef sign U+1D11E */
 }
 
+/* 长字符串测试，覆盖不同起始偏移下的分块扫描边界 */
+static void test_parse_long_string() {
+	char json[128], expect[128];
+	size_t len, offset, i, n;
+	lept_value v;
+
+	for (len = 0; len < 70; len++)
+		for (offset = 0; offset < 33; offset++) {
+			/* 以前导空白改变字符串起始地址的对齐 */
+			memset(json, ' ', offset);
+			n = offset;
+			json[n++] = '"';
+			for (i = 0; i < len; i++) {
+				expect[i] = (char)('a' + i % 26);
+				if (i == len / 2) {
+					expect[i] = '\n';
+					json[n++] = '\\';
+					json[n++] = 'n';
+				} else
+					json[n++] = expect[i];
+			}
+			json[n++] = '"';
+			json[n] = '\0';
+
+			lept_value_init(&v);
+			EXPECT_EQ_INT(LEPT_PARSE_OK, lept_parse(&v, json));
+			EXPECT_EQ_SIZE_T(len, lept_get_string_length(&v));
+			EXPECT_TRUE(memcmp(expect, lept_get_string(&v), len) == 0);
+			lept_free(&v);
+
+			/* 末尾控制字符与缺失引号 */
+			json[n - 1] = '\x01';
+			EXPECT_EQ_INT(LEPT_PARSE_INVALID_STRING_CHAR, lept_parse(&v, json));
+			json[n - 1] = '\0';
+			EXPECT_EQ_INT(LEPT_PARSE_MISS_QUOTATION_MARK, lept_parse(&v, json));
+		}
+}
+
 static void test_parse_array() {
 	size_t i, j;
 	lept_value v;
@@ -293,10 +374,162 @@ static void test_parse_object() {
 	lept_free(&v);
 }
 
+/* 四种空白字符以及不同长度、不同对齐的缩进 */
+static void test_parse_whitespace() {
+	char json[256];
+	size_t i, n, offset;
+	lept_value v;
+
+	TEST_BOLLEAN(LEPT_NULL, "\nnull\n");
+	TEST_BOLLEAN(LEPT_TRUE, " \t\n\r true \r\n");
+	TEST_NUMBER(1.0, "\n\n 1 \n");
+	TEST_ERROR(LEPT_PARSE_ROOT_NOT_SINGULAR, "null\n\n x");
+
+	for (n = 0; n < 70; n++)
+		for (offset = 0; offset < 33; offset += 5) {
+			size_t len = 0;
+			memset(json, ' ', offset);
+			len = offset;
+			memcpy(json + len, "[\n", 2);
+			len += 2;
+			for (i = 0; i < n; i++)
+				json[len++] = i % 7 == 6 ? '\t' : ' ';
+			memcpy(json + len, "1,\r\n", 4);
+			len += 4;
+			for (i = 0; i < n; i++)
+				json[len++] = ' ';
+			memcpy(json + len, "2\n]", 3);
+			len += 3;
+			json[len] = '\0';
+
+			lept_value_init(&v);
+			EXPECT_EQ_INT(LEPT_PARSE_OK, lept_parse(&v, json));
+			EXPECT_EQ_SIZE_T(2, lept_get_array_size(&v));
+			lept_free(&v);
+		}
+
+	lept_value_init(&v);
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_parse(&v, "{\n"
+	                                            "    \"a\": [\n"
+	                                            "        1,\n"
+	                                            "        2\n"
+	                                            "    ],\n"
+	                                            "    \"b\": {}\n"
+	                                            "}\n"));
+	EXPECT_EQ_INT(LEPT_OBJECT, lept_get_type(&v));
+	EXPECT_EQ_SIZE_T(2, lept_get_object_size(&v));
+	lept_free(&v);
+}
+
+static void test_parse_n() {
+	const char* json =
+	    " { \"num\" : [ 0, -1.5e+3, 12345678901234567890, 3.14159265358979, "
+	    "1E-7 ],\n\t\"str\":\"ab\\\"c\\u00e9\\uD834\\uDD1E "
+	    "0123456789abcdefghijklmnopqrstuvwxyz\", \"lit\" : [true,false,"
+	    "null], \"obj\":{\"\":{}}, \"arr\":[[],[\"\"]] }   ";
+	size_t i, len = strlen(json);
+	char* prefix = (char*)malloc(len + 1);
+	char* padded = (char*)malloc(len + LEPT_PARSE_PADDING);
+	lept_value v, h;
+
+	/* 每个前缀都与以 '\0' 结尾时的解析结果一致，缓冲区恰好为 i 字节 */
+	for (i = 0; i <= len; i++) {
+		char* buf = (char*)malloc(i > 0 ? i : 1);
+		int ret;
+		memcpy(buf, json, i);
+		memcpy(prefix, json, i);
+		prefix[i] = '\0';
+		lept_value_init(&v);
+		lept_value_init(&h);
+		ret = lept_parse(&h, prefix);
+		EXPECT_EQ_INT(ret, lept_parse_n(&v, buf, i));
+		if (ret == LEPT_PARSE_OK)
+			EXPECT_TRUE(lept_is_equal(&v, &h));
+		lept_free(&v);
+
+		/* 填充区中放置可被误读为 Json 的内容 */
+		memcpy(padded, json, i);
+		memset(padded + i, '1', LEPT_PARSE_PADDING);
+		EXPECT_EQ_INT(ret, lept_parse_padded(&v, padded, i));
+		if (ret == LEPT_PARSE_OK)
+			EXPECT_TRUE(lept_is_equal(&v, &h));
+		lept_free(&v);
+		memset(padded + i, ' ', LEPT_PARSE_PADDING);
+		EXPECT_EQ_INT(ret, lept_parse_padded(&v, padded, i));
+		lept_free(&v);
+		lept_free(&h);
+		free(buf);
+	}
+
+	/* 长度范围内的 '\0' 是非法字符而非输入结束 */
+	lept_value_init(&v);
+	EXPECT_EQ_INT(LEPT_PARSE_EXPECT_VALUE, lept_parse_n(&v, NULL, 0));
+	EXPECT_EQ_INT(LEPT_PARSE_INVALID_VALUE, lept_parse_n(&v, "\0", 1));
+	EXPECT_EQ_INT(LEPT_PARSE_ROOT_NOT_SINGULAR, lept_parse_n(&v, "1\0", 2));
+	EXPECT_EQ_INT(LEPT_PARSE_INVALID_STRING_CHAR,
+	              lept_parse_n(&v, "\"a\0\"", 4));
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_parse_n(&v, "[1,2] trailing", 5));
+	EXPECT_EQ_SIZE_T(2, lept_get_array_size(&v));
+	lept_free(&v);
+
+	free(prefix);
+	free(padded);
+}
+
+/* 写入临时文件后解析 */
+static int test_parse_file_content(lept_value* v, const char* json,
+                                   size_t len) {
+	const char* path = "test_parse_file.json";
+	FILE* fp = fopen(path, "wb");
+	int ret;
+	fwrite(json, 1, len, fp);
+	fclose(fp);
+	ret = lept_parse_file(v, path, LEPT_FILE_POPULATE | LEPT_FILE_HUGE_PAGES);
+	remove(path);
+	return ret;
+}
+
+static void test_parse_file() {
+	const char* json = "{\"a\":[1,2,\"x\"],\"b\":null}";
+	char* buf = (char*)malloc(4096);
+	lept_value v, h;
+
+	lept_value_init(&v);
+	lept_value_init(&h);
+	EXPECT_EQ_INT(LEPT_PARSE_FILE_ERROR,
+	              lept_parse_file(&v, "no/such/file.json", 0));
+	EXPECT_EQ_INT(LEPT_PARSE_EXPECT_VALUE, test_parse_file_content(&v, "", 0));
+
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_parse(&h, json));
+	EXPECT_EQ_INT(LEPT_PARSE_OK,
+	              test_parse_file_content(&v, json, strlen(json)));
+	EXPECT_TRUE(lept_is_equal(&v, &h));
+	lept_free(&v);
+	lept_free(&h);
+
+	/* 文件恰好占满整页，末尾之后没有可读空间 */
+	memset(buf, ' ', 4096);
+	buf[0] = '[';
+	buf[4094] = '1';
+	buf[4095] = ']';
+	EXPECT_EQ_INT(LEPT_PARSE_OK, test_parse_file_content(&v, buf, 4096));
+	EXPECT_EQ_SIZE_T(1, lept_get_array_size(&v));
+	lept_free(&v);
+	buf[0] = '"';
+	memset(buf + 1, 'a', 4095);
+	EXPECT_EQ_INT(LEPT_PARSE_MISS_QUOTATION_MARK,
+	              test_parse_file_content(&v, buf, 4096));
+	memset(buf, ' ', 4096);
+	EXPECT_EQ_INT(LEPT_PARSE_EXPECT_VALUE,
+	              test_parse_file_content(&v, buf, 4096));
+	free(buf);
+}
+
 static void test_parse_expect_value() {
 
 	TEST_ERROR(LEPT_PARSE_EXPECT_VALUE, "");
 	TEST_ERROR(LEPT_PARSE_EXPECT_VALUE, " ");
+	TEST_ERROR(LEPT_PARSE_EXPECT_VALUE, " \t\n\r");
 }
 
 static void test_parse_invalid_value() {
@@ -407,6 +640,53 @@ static void test_parse_miss_comma_or_curly_bracket() {
 	TEST_ERROR(LEPT_PARSE_MISS_COMMA_OR_CURLY_BRACKET, "{\"a\":{}");
 }
 
+static void test_parse_too_deep() {
+	static const lept_handler empty = {NULL, NULL, NULL, NULL, NULL,
+	                                   NULL, NULL, NULL, NULL};
+	static char json[5 * (LEPT_PARSE_MAX_DEPTH + 1) + 2];
+	lept_value v;
+	lept_push_parser* pp;
+	size_t i, n = LEPT_PARSE_MAX_DEPTH;
+
+	/* 恰好 LEPT_PARSE_MAX_DEPTH 层 */
+	for (i = 0; i < n; i++) {
+		json[i] = '[';
+		json[n + i] = ']';
+	}
+	json[2 * n] = '\0';
+	lept_value_init(&v);
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_parse(&v, json));
+	EXPECT_EQ_INT(LEPT_ARRAY, lept_get_type(&v));
+	lept_free(&v);
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_parse_lazy(&v, json));
+	lept_free(&v);
+
+	/* 多一层 */
+	json[2 * n] = ']';
+	memmove(json + 1, json, 2 * n);
+	json[2 * n + 2] = '\0';
+	TEST_ERROR(LEPT_PARSE_TOO_DEEP, json);
+	EXPECT_EQ_INT(LEPT_PARSE_TOO_DEEP, lept_parse_lazy(&v, json));
+	EXPECT_EQ_INT(LEPT_PARSE_TOO_DEEP, lept_parse_sax(json, &empty, NULL));
+
+	/* 推送式解析同样受限，出错后可继续使用 */
+	pp = lept_push_parser_new();
+	EXPECT_EQ_INT(LEPT_PARSE_TOO_DEEP,
+	              lept_push_parser_feed(pp, json, 2 * n + 2));
+	EXPECT_EQ_INT(LEPT_PARSE_TOO_DEEP, lept_push_parser_finish(pp, &v));
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_push_parser_feed(pp, json + 1, 2 * n));
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_push_parser_finish(pp, &v));
+	EXPECT_EQ_INT(LEPT_ARRAY, lept_get_type(&v));
+	lept_free(&v);
+	lept_push_parser_free(pp);
+
+	/* 对象嵌套，检查在解析到末尾之前发生 */
+	for (i = 0; i <= n; i++)
+		memcpy(json + 5 * i, "{\"k\":", 5);
+	json[5 * (n + 1)] = '\0';
+	TEST_ERROR(LEPT_PARSE_TOO_DEEP, json);
+}
+
 static void test_stringify_number() {
 	TEST_ROUNDTRIP("0");
 	TEST_ROUNDTRIP("-0");
@@ -420,14 +700,51 @@ static void test_stringify_number() {
 	TEST_ROUNDTRIP("1.234e-20");
 
 	TEST_ROUNDTRIP("1.0000000000000002");      /* the smallest number > 1 */
-	TEST_ROUNDTRIP("4.9406564584124654e-324"); /* minimum denormal */
-	TEST_ROUNDTRIP("-4.9406564584124654e-324");
-	TEST_ROUNDTRIP("2.2250738585072009e-308"); /* Max subnormal double */
-	TEST_ROUNDTRIP("-2.2250738585072009e-308");
+	TEST_ROUNDTRIP("5e-324"); /* minimum denormal */
+	TEST_ROUNDTRIP("-5e-324");
+	TEST_ROUNDTRIP("2.225073858507201e-308"); /* Max subnormal double */
+	TEST_ROUNDTRIP("-2.225073858507201e-308");
 	TEST_ROUNDTRIP("2.2250738585072014e-308"); /* Min normal positive double */
 	TEST_ROUNDTRIP("-2.2250738585072014e-308");
 	TEST_ROUNDTRIP("1.7976931348623157e+308"); /* Max double */
 	TEST_ROUNDTRIP("-1.7976931348623157e+308");
+
+	/* 输出最短可往返表示 */
+	TEST_ROUNDTRIP("0.1");
+	TEST_ROUNDTRIP("0.0001");
+	TEST_ROUNDTRIP("1e-05");
+	TEST_ROUNDTRIP("123.456");
+	TEST_ROUNDTRIP("9007199254740992");
+	TEST_ROUNDTRIP("12345678901234568");
+	TEST_ROUNDTRIP("1.2345678901234568e+17");
+}
+
+/* 随机位模式生成后重新解析，结果须与原值逐位相同 */
+static void test_stringify_number_random() {
+	unsigned long seed = 7;
+	int i, j;
+
+	for (i = 0; i < 100000; i++) {
+		lept_value v;
+		unsigned char bytes[sizeof(double)];
+		double d;
+		char* json;
+
+		for (j = 0; j < (int)sizeof(double); j++) {
+			seed = seed * 1103515245UL + 12345UL;
+			bytes[j] = (unsigned char)(seed >> 16);
+		}
+		memcpy(&d, bytes, sizeof(d));
+		if (d != d || d == HUGE_VAL || d == -HUGE_VAL)
+			continue;
+
+		lept_value_init(&v);
+		lept_set_number(&v, d);
+		json = lept_stringify(&v, NULL);
+		EXPECT_EQ_INT(LEPT_PARSE_OK, lept_parse(&v, json));
+		EXPECT_TRUE(memcmp(&d, &v.u.n, sizeof(double)) == 0);
+		free_ptr(json);
+	}
 }
 
 static void test_stringify_string() {
@@ -436,6 +753,13 @@ static void test_stringify_string() {
 	TEST_ROUNDTRIP("\"Hello\\nWorld\"");
 	TEST_ROUNDTRIP("\"\\\" \\\\ / \\b \\f \\n \\r \\t\"");
 	TEST_ROUNDTRIP("\"Hello\\u0000World\"");
+	/* 转义字符位于整块检查的各个位置 */
+	TEST_ROUNDTRIP("\"0123456789abcdef0123456789abcde\\\"0123456789abcdef"
+	               "0123456789abcdef\\u001F\\t\"");
+	TEST_ROUNDTRIP("\"\\n0123456789abcdef0123456789abcdef0123456789abcdef"
+	               "0123456789abcde\\\\\"");
+	TEST_ROUNDTRIP("\"0123456789abcdef0123456789abcdef\\u00010123456789abc"
+	               "\177\303\251\344\270\255\"");
 }
 
 static void test_stringify_array() {
@@ -454,6 +778,100 @@ static void test_stringify_object() {
 /*******************************/
 
 /* lept_parse() */
+#if defined(LEPT_COMPACT) && defined(LEPT_LEN_MAX)
+/* 紧凑布局的长度上限，make test-compact 以较小的 LEPT_LEN_MAX 编译 */
+static void test_parse_too_long() {
+	static const lept_handler empty = {NULL, NULL, NULL, NULL, NULL,
+	                                   NULL, NULL, NULL, NULL};
+	const size_t n = LEPT_LEN_MAX;
+	char* json = (char*)malloc(10 * (n + 1) + 2);
+	lept_value v;
+	lept_push_parser* pp = lept_push_parser_new();
+	size_t i, len;
+
+	/* 字符串恰好 LEPT_LEN_MAX 字节 */
+	json[0] = '"';
+	memset(json + 1, 'a', n);
+	json[n + 1] = '"';
+	json[n + 2] = '\0';
+	lept_value_init(&v);
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_parse(&v, json));
+	EXPECT_EQ_SIZE_T(n, lept_get_string_length(&v));
+	lept_free(&v);
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_push_parser_feed(pp, json, n + 2));
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_push_parser_finish(pp, &v));
+	EXPECT_EQ_SIZE_T(n, lept_get_string_length(&v));
+	lept_free(&v);
+
+	/* 多一个字节 */
+	json[n + 1] = 'a';
+	json[n + 2] = '"';
+	json[n + 3] = '\0';
+	TEST_ERROR(LEPT_PARSE_TOO_LONG, json);
+	lept_push_parser_feed(pp, json, n + 3);
+	EXPECT_EQ_INT(LEPT_PARSE_TOO_LONG, lept_push_parser_finish(pp, &v));
+	/* 事件式解析不构造值，不受此限制 */
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_parse_sax(json, &empty, NULL));
+
+	/* 按需解析限制根值原文的长度 */
+	json[n - 1] = '"';
+	json[n] = '\0';
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_parse_lazy(&v, json));
+	EXPECT_EQ_SIZE_T(n - 2, lept_get_string_length(&v));
+	lept_free(&v);
+	json[n - 1] = 'a';
+	json[n] = '"';
+	json[n + 1] = '\0';
+	EXPECT_EQ_INT(LEPT_PARSE_TOO_LONG, lept_parse_lazy(&v, json));
+
+	/* 数组恰好 LEPT_LEN_MAX 个元素 */
+	json[0] = '[';
+	for (i = 0; i < n; i++) {
+		json[2 * i + 1] = '0';
+		json[2 * i + 2] = ',';
+	}
+	json[2 * n] = ']';
+	json[2 * n + 1] = '\0';
+	lept_value_init(&v);
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_parse(&v, json));
+	EXPECT_EQ_SIZE_T(n, lept_get_array_size(&v));
+	lept_free(&v);
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_push_parser_feed(pp, json, 2 * n + 1));
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_push_parser_finish(pp, &v));
+	EXPECT_EQ_SIZE_T(n, lept_get_array_size(&v));
+	lept_free(&v);
+
+	/* 多一个元素 */
+	strcpy(json + 2 * n, ",0]");
+	TEST_ERROR(LEPT_PARSE_TOO_LONG, json);
+	lept_push_parser_feed(pp, json, 2 * n + 3);
+	EXPECT_EQ_INT(LEPT_PARSE_TOO_LONG, lept_push_parser_finish(pp, &v));
+
+	/* 对象恰好 LEPT_LEN_MAX 个成员，键各不相同 */
+	json[0] = '{';
+	for (i = 0, len = 1; i < n; i++)
+		len += sprintf(json + len, "\"%lx\":0,", (unsigned long)i);
+	json[len - 1] = '}';
+	lept_value_init(&v);
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_parse(&v, json));
+	EXPECT_EQ_SIZE_T(n, lept_get_object_size(&v));
+	lept_free(&v);
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_push_parser_feed(pp, json, len));
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_push_parser_finish(pp, &v));
+	EXPECT_EQ_SIZE_T(n, lept_get_object_size(&v));
+	lept_free(&v);
+
+	/* 多一个成员 */
+	len += sprintf(json + len - 1, ",\"%lx\":0}", (unsigned long)n) - 1;
+	TEST_ERROR(LEPT_PARSE_TOO_LONG, json);
+	lept_push_parser_feed(pp, json, len);
+	EXPECT_EQ_INT(LEPT_PARSE_TOO_LONG, lept_push_parser_finish(pp, &v));
+
+	lept_push_parser_free(pp);
+	free(json);
+}
+#endif
+
 static void test_parse() {
 
 	/* LEPT_PARSE_OK */
@@ -463,15 +881,26 @@ static void test_parse() {
 
 		/* number */
 		test_parse_number();
+		test_parse_number_random();
 
 		/* string */
 		test_parse_string();
+		test_parse_long_string();
 
 		/* array */
 		test_parse_array();
 
 		/* object */
 		test_parse_object();
+
+		/* whitespace */
+		test_parse_whitespace();
+
+		/* length-bounded input */
+		test_parse_n();
+
+		/* file */
+		test_parse_file();
 	}
 
 	/* LEPT_PARSE_EXPECT_VALUE */
@@ -512,6 +941,96 @@ static void test_parse() {
 
 	/* LEPT_PARSE_MISS_COMMA_OR_CURLY_BRACKET */
 	test_parse_miss_comma_or_curly_bracket();
+	/* LEPT_PARSE_TOO_DEEP */
+	test_parse_too_deep();
+#if defined(LEPT_COMPACT) && defined(LEPT_LEN_MAX)
+	test_parse_too_long();
+#endif
+}
+
+/* 流式生成：收集写出的块，第 fail 次写出时返回错误 */
+typedef struct {
+	char* buf;
+	size_t len;
+	int calls, fail;
+} test_writer;
+
+static int test_write(void* user, const char* s, size_t len) {
+	test_writer* w = (test_writer*)user;
+	if (++w->calls == w->fail)
+		return 1;
+	w->buf = (char*)realloc(w->buf, w->len + len);
+	memcpy(w->buf + w->len, s, len);
+	w->len += len;
+	return 0;
+}
+
+static void test_stringify_to() {
+	lept_value v, e;
+	test_writer w;
+	char *json, *s, buf[16];
+	size_t i, length;
+
+	/* 超过块大小的长字符串（含转义）与大量元素 */
+	s = (char*)malloc(100000);
+	for (i = 0; i < 100000; i++)
+		s[i] = "ab\"\n\\\001cd"[i % 8];
+	lept_value_init(&v);
+	lept_value_init(&e);
+	lept_set_array(&v, 0);
+	lept_set_string(&e, s, 100000);
+	lept_pushback_array_element(&v, &e);
+	for (i = 0; i < 10000; i++) {
+		lept_set_number(&e, i * 0.25);
+		lept_pushback_array_element(&v, &e);
+	}
+	lept_free(&e);
+	json = lept_stringify(&v, &length);
+
+	w.buf = NULL;
+	w.len = 0;
+	w.calls = w.fail = 0;
+	EXPECT_EQ_INT(LEPT_STRINGIFY_OK, lept_stringify_to(&v, test_write, &w));
+	EXPECT_TRUE(w.calls > 1);
+	EXPECT_TRUE(w.len == length && memcmp(json, w.buf, length) == 0);
+
+	/* 写出失败后不再调用写出函数 */
+	w.len = 0;
+	w.calls = 0;
+	w.fail = 2;
+	EXPECT_EQ_INT(LEPT_STRINGIFY_WRITE_ERROR,
+	              lept_stringify_to(&v, test_write, &w));
+	EXPECT_EQ_INT(2, w.calls);
+	free(w.buf);
+
+	/* 调用者缓冲区，不足时截断并返回完整长度 */
+	EXPECT_EQ_SIZE_T(length, lept_stringify_buffer(&v, buf, sizeof(buf)));
+	EXPECT_EQ_STRING("[\"ab\\\"\\n\\\\\\u000", buf, strlen(buf));
+	EXPECT_EQ_SIZE_T(length, lept_stringify_buffer(&v, NULL, 0));
+	{
+		static const size_t sizes[] = {1, 2, 33, 300, 100000, 100001, 0};
+		char* big = (char*)malloc(length + 2);
+		for (i = 0; sizes[i] != 0; i++) {
+			memset(big, 'x', length + 2);
+			EXPECT_EQ_SIZE_T(length, lept_stringify_buffer(&v, big, sizes[i]));
+			EXPECT_TRUE(memcmp(big, json, sizes[i] - 1) == 0);
+			EXPECT_TRUE(big[sizes[i] - 1] == '\0' && big[sizes[i]] == 'x');
+		}
+		EXPECT_EQ_SIZE_T(length,
+		                 lept_stringify_buffer(&v, big, length + 1));
+		EXPECT_TRUE(memcmp(big, json, length + 1) == 0);
+		free(big);
+	}
+	lept_free(&v);
+	free(json);
+
+	lept_parse(&v, "{\"a\":[1,true]}");
+	EXPECT_EQ_SIZE_T(14, lept_stringify_buffer(&v, buf, sizeof(buf)));
+	EXPECT_EQ_STRING("{\"a\":[1,true]}", buf, strlen(buf));
+	EXPECT_EQ_SIZE_T(14, lept_stringify_buffer(&v, buf, 14));
+	EXPECT_EQ_STRING("{\"a\":[1,true]", buf, strlen(buf));
+	lept_free(&v);
+	free(s);
 }
 
 static void test_stringify() {
@@ -519,9 +1038,11 @@ static void test_stringify() {
 	TEST_ROUNDTRIP("false");
 	TEST_ROUNDTRIP("true");
 	test_stringify_number();
+	test_stringify_number_random();
 	test_stringify_string();
 	test_stringify_array();
 	test_stringify_object();
+	test_stringify_to();
 }
 
 static void test_equal() {
@@ -549,6 +1070,52 @@ static void test_equal() {
 	TEST_EQUAL("{\"a\":1,\"b\":2}", "{\"a\":1,\"b\":2,\"c\":3}", 0);
 	TEST_EQUAL("{\"a\":{\"b\":{\"c\":{}}}}", "{\"a\":{\"b\":{\"c\":{}}}}", 1);
 	TEST_EQUAL("{\"a\":{\"b\":{\"c\":{}}}}", "{\"a\":{\"b\":{\"c\":[]}}}", 0);
+
+	TEST_EQUAL("0", "-0", 1);
+	TEST_EQUAL("[1,2]", "[2,1]", 0);
+	TEST_EQUAL("[\"a\",\"b\"]", "[\"b\",\"a\"]", 0);
+	TEST_EQUAL("{\"a\":\"b\"}", "{\"b\":\"a\"}", 0);
+	TEST_EQUAL("{\"a\":[1,{\"x\":1,\"y\":2}],\"b\":2}",
+	           "{\"b\":2,\"a\":[1,{\"y\":2,\"x\":1}]}", 1);
+	TEST_EQUAL("[[1,[2,[3]]],4]", "[[1,[2,[3]]],5]", 0);
+	TEST_EQUAL("[[1,[2,[3]]],4]", "[[1,[2,[4]]],4]", 0);
+	TEST_EQUAL("{\"a\":1,\"b\":2,\"c\":3,\"d\":4,\"e\":5,\"f\":6,\"g\":7,"
+	           "\"h\":8,\"i\":9,\"j\":10,\"k\":11,\"l\":12,\"m\":13,"
+	           "\"n\":14,\"o\":15,\"p\":16,\"q\":[17]}",
+	           "{\"q\":[17],\"p\":16,\"o\":15,\"n\":14,\"m\":13,\"l\":12,"
+	           "\"k\":11,\"j\":10,\"i\":9,\"h\":8,\"g\":7,\"f\":6,\"e\":5,"
+	           "\"d\":4,\"c\":3,\"b\":2,\"a\":1}",
+	           1);
+}
+
+static void test_hash() {
+	const char* json = "{\"s\":\"a long string that is not inline\","
+	                   "\"a\":[1,[true,null],{\"k\":\"v\"}],\"n\":-1.5}";
+	lept_value v, lazy, e;
+	size_t h;
+
+	/* 按需解析、修改前后与拷贝的散列一致 */
+	lept_value_init(&v);
+	lept_value_init(&lazy);
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_parse(&v, json));
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_parse_lazy(&lazy, json));
+	h = lept_hash(&v);
+	EXPECT_TRUE(lept_hash(&lazy) == h);
+	EXPECT_TRUE(lept_is_equal(&lazy, &v));
+
+	lept_value_init(&e);
+	lept_set_number(&e, 2.0);
+	lept_set_object_value_by_key(&v, "n", 1, &e);
+	EXPECT_TRUE(lept_hash(&v) != h);
+	EXPECT_FALSE(lept_is_equal(&lazy, &v));
+	lept_set_number(&e, -1.5);
+	lept_set_object_value_by_key(&v, "n", 1, &e);
+	EXPECT_TRUE(lept_hash(&v) == h);
+	EXPECT_TRUE(lept_is_equal(&v, &lazy));
+
+	lept_free(&e);
+	lept_free(&lazy);
+	lept_free(&v);
 }
 
 static void test_copy() {
@@ -563,6 +1130,56 @@ static void test_copy() {
 	lept_free(&v2);
 }
 
+static void test_copy_large() {
+	const char* json =
+	    "{\"k00\":0,\"k01\":\"a string longer than the inline buffer\","
+	    "\"k02\":[1,[2,[3]],{}],\"k03\":{\"x\":\"y\"},\"k04\":4,\"k05\":5,"
+	    "\"k06\":6,\"k07\":7,\"k08\":8,\"k09\":9,\"k10\":10,\"k11\":11,"
+	    "\"k12\":12,\"k13\":13,\"k14\":14,\"k15\":15,\"k16\":[]}";
+	lept_arena arena;
+	lept_value v, c, e;
+	lept_value* a;
+
+	lept_value_init(&v);
+	lept_value_init(&c);
+	lept_value_init(&e);
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_parse(&v, json));
+
+	/* 散列索引随成员复制，按键查找可用 */
+	lept_copy(&c, &v);
+	EXPECT_TRUE(lept_is_equal(&c, &v));
+	EXPECT_EQ_DOUBLE(15.0, lept_get_number(lept_find_object_value(&c, "k15", 3)));
+	lept_set_number(&e, 17.0);
+	lept_set_object_value_by_key(&c, "k17", 3, &e);
+	EXPECT_EQ_SIZE_T(18, lept_get_object_size(&c));
+	EXPECT_EQ_SIZE_T(17, lept_find_object_index(&c, "k17", 3));
+	EXPECT_EQ_SIZE_T(LEPT_KEY_NOT_EXIST, lept_find_object_index(&v, "k17", 3));
+
+	/* 源为目标的子值 */
+	lept_copy(&c, lept_find_object_value(&c, "k02", 3));
+	EXPECT_TRUE(lept_is_equal(&c, lept_find_object_value(&v, "k02", 3)));
+
+	/* 复制到内存池，修改时与 lept_parse_arena 的结果一样复制到堆上 */
+	lept_arena_init(&arena, 0);
+	lept_copy_arena(&c, &v, &arena);
+	EXPECT_TRUE(lept_is_equal(&c, &v));
+	a = (lept_value*)lept_find_object_value(&c, "k02", 3);
+	lept_pushback_array_element(a, &e);
+	EXPECT_EQ_SIZE_T(4, lept_get_array_size(a));
+	lept_set_object_value_by_key(&c, "k17", 3, &e);
+	lept_remove_object_value_by_key(&c, "k00", 3);
+	EXPECT_EQ_SIZE_T(17, lept_get_object_size(&c));
+	EXPECT_EQ_DOUBLE(17.0, lept_get_number(lept_find_object_value(&c, "k17", 3)));
+	EXPECT_EQ_STRING("a string longer than the inline buffer",
+	                 lept_get_string(lept_find_object_value(&c, "k01", 3)),
+	                 lept_get_string_length(lept_find_object_value(&c, "k01", 3)));
+	lept_free(&c);
+	lept_arena_free(&arena);
+
+	lept_free(&e);
+	lept_free(&v);
+}
+
 static void test_move() {
 	lept_value v1, v2, v3;
 	lept_value_init(&v1);
@@ -579,6 +1196,96 @@ static void test_move() {
 	lept_free(&v3);
 }
 
+static void test_move_in() {
+	lept_value a, o, e, *p;
+	char* s;
+	size_t i;
+
+	lept_value_init(&a);
+	lept_set_array(&a, 0);
+	lept_value_init(&e);
+	lept_set_string(&e, "a long string that is not inline", 32);
+	lept_pushback_array_element_move(&a, &e);
+	EXPECT_EQ_INT(LEPT_NULL, lept_get_type(&e));
+	lept_set_number(&e, 0.0);
+	lept_insert_array_element_move(&a, &e, 0);
+	for (i = 1; i <= 3; i++)
+		lept_set_number(lept_emplace_array_element(&a, i), (double)i);
+	lept_set_boolean(lept_emplace_back_array_element(&a), 1);
+	EXPECT_EQ_SIZE_T(6, lept_get_array_size(&a));
+	for (i = 0; i <= 3; i++)
+		EXPECT_EQ_DOUBLE((double)i,
+		                 lept_get_number(lept_get_array_element(&a, i)));
+	EXPECT_EQ_STRING("a long string that is not inline",
+	                 lept_get_string(lept_get_array_element(&a, 4)),
+	                 lept_get_string_length(lept_get_array_element(&a, 4)));
+	EXPECT_EQ_INT(LEPT_TRUE, lept_get_type(lept_get_array_element(&a, 5)));
+
+	lept_value_init(&o);
+	lept_set_object(&o, 0);
+	EXPECT_EQ_INT(INSERT_OBJECT_OK,
+	              lept_set_object_value_by_key_move(&o, "a", 1, &a));
+	EXPECT_EQ_INT(LEPT_NULL, lept_get_type(&a));
+	lept_set_number(&e, 1.0);
+	EXPECT_EQ_INT(MODIFY_OBJECT_OK,
+	              lept_set_object_value_by_key_move(&o, "a", 1, &e));
+	EXPECT_EQ_SIZE_T(1, lept_get_object_size(&o));
+	EXPECT_EQ_DOUBLE(1.0,
+	                 lept_get_number(lept_get_object_value_by_key(&o, "a", 1)));
+	for (i = 0; i < 20; i++) {
+		char key[2] = "a";
+		key[0] += i;
+		p = lept_emplace_object_value(&o, key, 1);
+		if (i == 0)
+			EXPECT_EQ_DOUBLE(1.0, lept_get_number(p));
+		else
+			EXPECT_EQ_INT(LEPT_NULL, lept_get_type(p));
+		lept_set_number(p, (double)i);
+	}
+	EXPECT_EQ_SIZE_T(20, lept_get_object_size(&o));
+	EXPECT_EQ_DOUBLE(7.0,
+	                 lept_get_number(lept_get_object_value_by_key(&o, "h", 1)));
+
+	s = (char*)malloc(6);
+	memcpy(s, "Hello", 6);
+	lept_set_string_adopt(lept_emplace_object_value(&o, "s", 1), s, 5);
+	EXPECT_TRUE(lept_get_string(lept_get_object_value_by_key(&o, "s", 1)) ==
+	            s);
+
+	/* 键与值位于对象自身的成员中，插入时扩容 */
+	lept_set_object(&o, 0);
+	lept_set_string(lept_emplace_object_value(&o, "k", 1), "key", 3);
+	lept_set_string(lept_emplace_object_value(&o, "v", 1),
+	                "a long string that is not inline", 32);
+	lept_shrink_object(&o);
+	p = (lept_value*)lept_get_object_value_by_key(&o, "k", 1);
+	EXPECT_EQ_INT(INSERT_OBJECT_OK,
+	              lept_set_object_value_by_key(
+	                  &o, lept_get_string(p), 3,
+	                  lept_get_object_value_by_key(&o, "v", 1)));
+	p = (lept_value*)lept_get_object_value_by_key(&o, "key", 3);
+	EXPECT_EQ_STRING("a long string that is not inline", lept_get_string(p),
+	                 lept_get_string_length(p));
+	lept_shrink_object(&o);
+	EXPECT_EQ_INT(INSERT_OBJECT_OK,
+	              lept_set_object_value_by_key_move(
+	                  &o, "m", 1,
+	                  (lept_value*)lept_get_object_value_by_key(&o, "v", 1)));
+	p = (lept_value*)lept_get_object_value_by_key(&o, "m", 1);
+	EXPECT_EQ_STRING("a long string that is not inline", lept_get_string(p),
+	                 lept_get_string_length(p));
+	EXPECT_EQ_INT(LEPT_NULL,
+	              lept_get_type(lept_get_object_value_by_key(&o, "v", 1)));
+	lept_shrink_object(&o);
+	p = (lept_value*)lept_get_object_value_by_key(&o, "k", 1);
+	lept_set_number(lept_emplace_object_value(&o, lept_get_string(p), 2), 5.0);
+	EXPECT_EQ_SIZE_T(5, lept_get_object_size(&o));
+	EXPECT_EQ_DOUBLE(5.0,
+	                 lept_get_number(lept_get_object_value_by_key(&o, "ke", 2)));
+
+	lept_free(&o);
+}
+
 static void test_swap() {
 	lept_value v1, v2;
 	lept_value_init(&v1);
@@ -594,6 +1301,556 @@ static void test_swap() {
 	lept_free(&v2);
 }
 
+/* 记录分配与释放次数，counts[0] 为分配数，counts[1] 为释放数 */
+static void* test_counting_alloc(void* user, size_t size) {
+	((size_t*)user)[0]++;
+	return malloc(size);
+}
+static void* test_counting_realloc(void* user, void* p, size_t size) {
+	if (p == NULL)
+		((size_t*)user)[0]++;
+	return realloc(p, size);
+}
+static void test_counting_free(void* user, void* p) {
+	((size_t*)user)[1]++;
+	free(p);
+}
+
+static void test_allocator() {
+	const char* json = "{\"s\":\"a long string that is not inline\","
+	                   "\"a\":[1,[true,null],{\"k\":\"v\"}],\"n\":-1.5}";
+	size_t counts[2] = {0, 0};
+	lept_allocator a;
+	lept_parser* p;
+	lept_push_parser* pp;
+	lept_arena arena;
+	lept_value v, copy, e;
+	char* out;
+	size_t len;
+
+	a.alloc = test_counting_alloc;
+	a.realloc = test_counting_realloc;
+	a.free = test_counting_free;
+	a.user = counts;
+
+	/* 全局分配器：解析、修改、拷贝与生成均经由 a */
+	lept_set_allocator(&a);
+	EXPECT_TRUE(lept_get_allocator()->user == counts);
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_parse(&v, json));
+	lept_value_init(&e);
+	lept_set_string(&e, "another long string, not inline", 31);
+	lept_set_object_value_by_key(&v, "t", 1, &e);
+	lept_pushback_array_element_move(lept_emplace_object_value(&v, "a", 1),
+	                                 &e);
+	lept_value_init(&copy);
+	lept_copy(&copy, &v);
+	out = lept_stringify(&copy, &len);
+	EXPECT_TRUE(len > 0);
+	test_counting_free(counts, out);
+	lept_free(&copy);
+
+	/* 生成到调用者缓冲区不经分配器 */
+	len = counts[0];
+	out = (char*)malloc(16);
+	lept_stringify_buffer(&v, out, 16);
+	lept_stringify_buffer(&v, NULL, 0);
+	EXPECT_EQ_SIZE_T(len, counts[0]);
+	free(out);
+	lept_free(&v);
+	lept_set_allocator(NULL);
+	EXPECT_TRUE(lept_get_allocator()->user == NULL);
+	EXPECT_TRUE(counts[0] > 0);
+	EXPECT_EQ_SIZE_T(counts[0], counts[1]);
+
+	/* 解析器的栈使用单独的分配器，结果仍在全局分配器上 */
+	counts[0] = counts[1] = 0;
+	p = lept_parser_new_allocator(&a);
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_parser_parse(p, &v, json));
+	lept_free(&v);
+	lept_parser_free(p);
+	pp = lept_push_parser_new_allocator(&a);
+	lept_push_parser_feed(pp, json, 10);
+	lept_push_parser_feed(pp, json + 10, strlen(json) - 10);
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_push_parser_finish(pp, &v));
+	lept_free(&v);
+	lept_push_parser_free(pp);
+	EXPECT_TRUE(counts[0] > 0);
+	EXPECT_EQ_SIZE_T(counts[0], counts[1]);
+
+	/* 内存池的块使用单独的分配器 */
+	counts[0] = counts[1] = 0;
+	lept_arena_init_allocator(&arena, 0, &a);
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_parse_arena(&v, json, &arena));
+	EXPECT_TRUE(counts[0] > 0);
+	lept_arena_free(&arena);
+	EXPECT_EQ_SIZE_T(counts[0], counts[1]);
+}
+
+static void test_arena() {
+	const char* json = "{\"s\":\"abc\",\"a\":[1,\"x\",[true,null]],"
+	                   "\"o\":{\"k\":\"v\",\"n\":-1.5}}";
+	lept_arena arena;
+	lept_value v, h, e, copy;
+	lept_value* a;
+	lept_value* o;
+	char* json2;
+	size_t length;
+
+	/* 小块尺寸，覆盖多块链接与大块单独分配 */
+	lept_arena_init(&arena, 64);
+	lept_value_init(&v);
+	lept_value_init(&h);
+	lept_value_init(&e);
+	lept_value_init(&copy);
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_parse_arena(&v, json, &arena));
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_parse(&h, json));
+	EXPECT_TRUE(lept_is_equal(&v, &h));
+	json2 = lept_stringify(&v, &length);
+	EXPECT_EQ_STRING("{\"s\":\"abc\",\"a\":[1,\"x\",[true,null]],"
+	                 "\"o\":{\"k\":\"v\",\"n\":-1.5}}",
+	                 json2, length);
+	free_ptr(json2);
+
+	/* 修改内存池中的值，扩容、删除时复制到堆上 */
+	a = (lept_value*)lept_find_object_value(&v, "a", 1);
+	o = (lept_value*)lept_find_object_value(&v, "o", 1);
+	lept_set_string(&e, "y", 1);
+	lept_pushback_array_element(a, &e);
+	lept_erase_array_element(a, 0, 1);
+	lept_set_object_value_by_key(o, "new", 3, &e);
+	lept_remove_object_value_by_key(o, "k", 1);
+	lept_set_object_value_by_index(&v, 0, &e);
+	lept_remove_object_value_by_key(&v, "s", 1);
+
+	a = (lept_value*)lept_find_object_value(&h, "a", 1);
+	o = (lept_value*)lept_find_object_value(&h, "o", 1);
+	lept_pushback_array_element(a, &e);
+	lept_erase_array_element(a, 0, 1);
+	lept_set_object_value_by_key(o, "new", 3, &e);
+	lept_remove_object_value_by_key(o, "k", 1);
+	lept_set_object_value_by_index(&h, 0, &e);
+	lept_remove_object_value_by_key(&h, "s", 1);
+	EXPECT_TRUE(lept_is_equal(&v, &h));
+
+	/* 深拷贝结果不依赖内存池 */
+	lept_copy(&copy, &v);
+	lept_free(&v);
+	lept_arena_free(&arena);
+	EXPECT_TRUE(lept_is_equal(&copy, &h));
+
+	/* 解析失败时已分配的空间随内存池释放 */
+	EXPECT_EQ_INT(LEPT_PARSE_MISS_COMMA_OR_CURLY_BRACKET,
+	              lept_parse_arena(&v, "{\"a\":[\"b\"],\"c\":\"d\" ", &arena));
+	EXPECT_EQ_INT(LEPT_NULL, lept_get_type(&v));
+	EXPECT_EQ_INT(LEPT_PARSE_ROOT_NOT_SINGULAR,
+	              lept_parse_arena(&v, "[\"a\"] x", &arena));
+	EXPECT_EQ_INT(LEPT_NULL, lept_get_type(&v));
+	lept_arena_free(&arena);
+
+	lept_free(&e);
+	lept_free(&h);
+	lept_free(&copy);
+}
+
+static void test_insitu() {
+	static const char* const cases[] = {
+	    "\"\"", "\"Hello\"", "\"Hello\\nWorld\"",
+	    "\"\\\" \\\\ \\/ \\b \\f \\n \\r \\t\"", "\"Hello\\u0000World\"",
+	    "\"\\u0024 \\u00A2 \\u20AC \\uD834\\uDD1E\"",
+	    "{\"k\\u00e9y\":[\"a\\tb\",{\"\":\"\\\"\"}],\"n\":1.5,\"t\":true}",
+	    "[\"abc\\\"def\",\"0123456789abcdefghijklmnopqrstuvwxyz\\n\"]",
+	    "\"\\v\"", "\"abc", "\"\\uD800\\uDBFF\"", "{\"a\":\"b\",\"c\" 1}",
+	    "[\"a\", \"b\"] x", "\"\x01\""};
+	char buf[128];
+	size_t i;
+	lept_value v, h, e;
+
+	for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+		int ret;
+		strcpy(buf, cases[i]);
+		lept_value_init(&v);
+		lept_value_init(&h);
+		ret = lept_parse(&h, cases[i]);
+		EXPECT_EQ_INT(ret, lept_parse_insitu(&v, buf));
+		if (ret == LEPT_PARSE_OK)
+			EXPECT_TRUE(lept_is_equal(&v, &h));
+		lept_free(&v);
+		lept_free(&h);
+	}
+
+	/* 字符串与键直接指向输入缓冲区 */
+	strcpy(buf, "{\"a\\nb\":\"x\\u00e9y\"}");
+	lept_value_init(&v);
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_parse_insitu(&v, buf));
+	EXPECT_TRUE(lept_get_object_key(&v, 0) == buf + 2);
+	EXPECT_EQ_STRING("a\nb", lept_get_object_key(&v, 0),
+	                 lept_get_object_key_length(&v, 0));
+	EXPECT_TRUE(lept_get_string(lept_get_object_value_by_index(&v, 0)) >= buf &&
+	            lept_get_string(lept_get_object_value_by_index(&v, 0)) <
+	                buf + sizeof(buf));
+	EXPECT_EQ_STRING("x\xC3\xA9y",
+	                 lept_get_string(lept_get_object_value_by_index(&v, 0)),
+	                 lept_get_string_length(lept_get_object_value_by_index(&v, 0)));
+
+	/* 修改后的键与值归对象所有 */
+	lept_value_init(&e);
+	lept_set_string(&e, "z", 1);
+	lept_set_object_value_by_key(&v, "c", 1, &e);
+	lept_set_object_value_by_index(&v, 0, &e);
+	memset(buf, 0, sizeof(buf));
+	EXPECT_EQ_STRING("a\nb", lept_get_object_key(&v, 0),
+	                 lept_get_object_key_length(&v, 0));
+	EXPECT_EQ_STRING("z", lept_get_string(lept_get_object_value_by_index(&v, 0)),
+	                 lept_get_string_length(lept_get_object_value_by_index(&v, 0)));
+	lept_free(&e);
+	lept_free(&v);
+}
+
+static void test_lazy() {
+	static const char* const cases[] = {
+	    "null", " 1.5 ", "\"\"", "\"Hello\\u0000World\\n\"", "[ ]", "{ }",
+	    "[ 1 , \"two\" , [ null , { } ] , { \"k\" : [ ] } ]",
+	    "{\"k\\u00e9y\":[\"a\\tb\",{\"\":\"\\\"]}\"}],\"n\":-0,\"t\":true}",
+	    "[[[[\"}\"]],[\"[\\\\\"]],{\"a\":{\"b\":[false]}}]",
+	    /* 错误与 lept_parse 一致 */
+	    "", "nul", "[1,]", "{\"a\" 1}", "[\"\\v\"]", "[1e309]", "[1] x",
+	    "{\"a\":[1,{\"b\":\"\x01\"}]}"};
+	char buf[64];
+	char* src;
+	size_t i;
+	lept_value v, h, e, c;
+	lept_arena arena;
+	const lept_value* b;
+
+	for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+		int ret;
+		lept_value_init(&h);
+		ret = lept_parse(&h, cases[i]);
+		EXPECT_EQ_INT(ret, lept_parse_lazy(&v, cases[i]));
+		if (ret == LEPT_PARSE_OK) {
+			char *s1 = lept_stringify(&h, NULL), *s2;
+			/* 拷贝时解码到副本中，源值在生成时解码 */
+			lept_value_init(&e);
+			lept_copy(&e, &v);
+			EXPECT_TRUE(lept_is_equal(&e, &h));
+			s2 = lept_stringify(&v, NULL);
+			EXPECT_TRUE(strcmp(s1, s2) == 0);
+			free(s1);
+			free(s2);
+			lept_free(&e);
+		}
+		lept_free(&v);
+		lept_free(&h);
+	}
+
+	/* 子值在首次访问时才从原文解码 */
+	strcpy(buf, "{\"a\":[1,\"x\"],\"b\":{\"c\":\"d\"}}");
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_parse_lazy(&v, buf));
+	EXPECT_EQ_SIZE_T(2, lept_get_array_size(lept_find_object_value(&v, "a", 1)));
+	buf[23] = 'e';
+	b = lept_find_object_value(&v, "b", 1);
+	EXPECT_EQ_STRING("e", lept_get_string(lept_find_object_value(b, "c", 1)),
+	                 lept_get_string_length(lept_find_object_value(b, "c", 1)));
+
+	/* 解码后可照常修改 */
+	lept_value_init(&e);
+	lept_set_number(&e, 2.0);
+	lept_pushback_array_element((lept_value*)lept_find_object_value(&v, "a", 1),
+	                            &e);
+	lept_set_object_value_by_key((lept_value*)b, "f", 1, &e);
+	lept_free(&e);
+	lept_parse(&h, "{\"a\":[1,\"x\",2],\"b\":{\"c\":\"e\",\"f\":2}}");
+	EXPECT_TRUE(lept_is_equal(&h, &v));
+	lept_free(&h);
+	lept_free(&v);
+
+	/* 副本不引用原文，源值可在原文释放前照常释放 */
+	src = (char*)malloc(64);
+	strcpy(src, "{\"k\":[\"long string\",{\"n\":[1,\"xy\"]}],\"s\":\"abc\"}");
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_parse_lazy(&v, src));
+	lept_parse(&h, src);
+	lept_value_init(&e);
+	lept_copy(&e, &v);
+	lept_value_init(&c);
+	lept_arena_init(&arena, 0);
+	lept_copy_arena(&c, &v, &arena);
+	lept_free(&v);
+	memset(src, ' ', strlen(src));
+	free(src);
+	EXPECT_TRUE(lept_is_equal(&h, &e));
+	EXPECT_TRUE(lept_is_equal(&h, &c));
+	lept_arena_free(&arena);
+	lept_free(&e);
+	lept_free(&h);
+
+	/* lept_load 之后不再引用原文 */
+	strcpy(buf, "[{\"a\":[\"x\",{}]},\"yz\",[[true]]]");
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_parse_lazy(&v, buf));
+	lept_load(&v);
+	lept_parse(&h, buf);
+	memset(buf, ' ', strlen(buf));
+	EXPECT_TRUE(lept_is_equal(&h, &v));
+	lept_free(&h);
+	lept_free(&v);
+}
+
+static void test_keypool() {
+	lept_keypool* kp = lept_keypool_new();
+	lept_value v, w, h, e;
+	const lept_value* a;
+
+	lept_value_init(&h);
+	EXPECT_EQ_INT(LEPT_PARSE_OK,
+	              lept_parse_keypool(&v,
+	                                 "[{\"id\":1,\"name\":\"a\"},"
+	                                 "{\"id\":2,\"name\":\"b\",\"x\":{\"id\":3}}]",
+	                                 kp));
+	EXPECT_EQ_SIZE_T(3, lept_keypool_size(kp));
+	EXPECT_EQ_INT(LEPT_PARSE_OK,
+	              lept_parse(&h, "[{\"id\":1,\"name\":\"a\"},"
+	                             "{\"id\":2,\"name\":\"b\",\"x\":{\"id\":3}}]"));
+	EXPECT_TRUE(lept_is_equal(&v, &h));
+
+	/* 相同的键共享同一份存储，包括不同的解析 */
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_parse_keypool(&w, "{\"name\":[]}", kp));
+	EXPECT_EQ_SIZE_T(3, lept_keypool_size(kp));
+	a = lept_get_array_element(&v, 1);
+	EXPECT_TRUE(lept_get_object_key(lept_get_array_element(&v, 0), 0) ==
+	            lept_get_object_key(a, 0));
+	EXPECT_TRUE(lept_get_object_key(&w, 0) == lept_get_object_key(a, 1));
+	EXPECT_TRUE(lept_find_object_value(a, lept_get_object_key(&w, 0), 1) ==
+	            NULL);
+
+	/* 修改后新键归对象所有，键池中的键不被释放 */
+	lept_value_init(&e);
+	lept_set_number(&e, 4.0);
+	lept_set_object_value_by_key(&w, "id", 2, &e);
+	lept_remove_object_value_by_index(&w, 0);
+	EXPECT_EQ_STRING("id", lept_get_object_key(&w, 0),
+	                 lept_get_object_key_length(&w, 0));
+	lept_free(&e);
+
+	/* 出错时已入池的键保留 */
+	EXPECT_EQ_INT(LEPT_PARSE_MISS_COLON,
+	              lept_parse_keypool(&e, "{\"id\":1,\"new\" 2}", kp));
+	EXPECT_EQ_SIZE_T(4, lept_keypool_size(kp));
+
+	lept_free(&w);
+	lept_free(&v);
+	lept_free(&h);
+	lept_keypool_free(kp);
+}
+
+/* 按给定块大小推送解析，与 lept_parse 的返回值及结果比较 */
+static void test_push_parser_chunks(lept_push_parser* pp, const char* json,
+                                    size_t first, size_t chunk) {
+	size_t i, len = strlen(json);
+	lept_value v, h;
+	int ret;
+	lept_value_init(&h);
+	ret = lept_parse(&h, json);
+	lept_push_parser_feed(pp, json, first);
+	for (i = first; i < len; i += chunk)
+		lept_push_parser_feed(pp, json + i, len - i < chunk ? len - i : chunk);
+	EXPECT_EQ_INT(ret, lept_push_parser_finish(pp, &v));
+	if (ret == LEPT_PARSE_OK)
+		EXPECT_TRUE(lept_is_equal(&v, &h));
+	else
+		EXPECT_EQ_INT(LEPT_NULL, lept_get_type(&v));
+	lept_free(&v);
+	lept_free(&h);
+}
+
+static void test_push_parser() {
+	static const char* const cases[] = {
+	    "null", " true ", "false", "0", "-0.0", "123.456e-7", "1E+400",
+	    "12345678901234567890123", "\"\"", "\"Hello\\nWorld\"",
+	    "\"\\u20AC \\uD834\\uDD1E \\\\ \\/ \\\"\"",
+	    "[ 1 , \"two\" , [ null , { } ] , { \"k\" : [ ] } ]",
+	    "{ \"a\" : { \"b\" : [ 1 , 2 , { \"c\" : true } ] }, \"d\" : \"e\" }",
+	    "[\"0123456789abcdefghijklmnopqrstuvwxyz0123456789abcdefghijklmnopqrstu"
+	    "vwxyz0123456789abcdefghijklmnopqrstuvwxyz0123456789abcdefghijklmnop"
+	    "qrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyz0123456789abcdefgh\"]",
+	    /* 错误输入 */
+	    "", " \n ", "nul", "nulx", "null x", "?", "+1", "-", "1.", "1e",
+	    "0123", "0x0", "[0123]", "{\"a\":0123}", "[1,]", "[1 2]", "[1",
+	    "[", "[\"a\", nul]", "\"abc", "\"a\\", "\"\\v\"", "\"\\u12\"",
+	    "\"\\uD800\"", "\"\\uD800\\\"\"", "\"\\uDBFF\\uE000\"", "\"\x01\"",
+	    "{", "{1:2}", "{\"a\" 1}", "{\"a\":1,}", "{\"a\":1 \"b\":2}",
+	    "{\"a\":[1}", "{\"a\"", "{\"a\":", "{\"a\":1", "{\"a\\q\":1}"};
+	lept_push_parser* pp = lept_push_parser_new();
+	size_t i, k;
+	lept_value v;
+
+	for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+		size_t len = strlen(cases[i]);
+		/* 任意一处切分为两块，以及逐字节送入 */
+		for (k = 0; k <= len; k++)
+			test_push_parser_chunks(pp, cases[i], k, len > 0 ? len : 1);
+		test_push_parser_chunks(pp, cases[i], 0, 1);
+	}
+
+	/* 出错后的输入被忽略，finish 后可继续使用 */
+	EXPECT_EQ_INT(LEPT_PARSE_MISS_COMMA_OR_SQUARE_BRACKET,
+	              lept_push_parser_feed(pp, "[1 2", 4));
+	EXPECT_EQ_INT(LEPT_PARSE_MISS_COMMA_OR_SQUARE_BRACKET,
+	              lept_push_parser_feed(pp, "]", 1));
+	EXPECT_EQ_INT(LEPT_PARSE_MISS_COMMA_OR_SQUARE_BRACKET,
+	              lept_push_parser_finish(pp, &v));
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_push_parser_feed(pp, "[1,", 3));
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_push_parser_feed(pp, "2]", 2));
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_push_parser_finish(pp, &v));
+	EXPECT_EQ_SIZE_T(2, lept_get_array_size(&v));
+	lept_free(&v);
+
+	/* 未完成的文档随解析器释放 */
+	lept_push_parser_feed(pp, "{\"a\":[\"b\",{\"c", 13);
+	lept_push_parser_free(pp);
+}
+
+static void test_parser() {
+	static const char* const cases[] = {
+	    "null", "\"Hello\\nWorld\"",
+	    "[ 1 , \"two\" , [ null , { } ] , { \"k\" : [ ] } ]",
+	    "{ \"a\" : { \"b\" : [ 1 , 2 , { \"c\" : true } ] }, \"d\" : \"e\" }",
+	    "[1 2]", "{\"a\":[1}", "\"\\v\"", "null x", ""};
+	lept_parser* p = lept_parser_new();
+	lept_value v, h;
+	size_t i, k;
+	int ret;
+
+	/* 同一解析器多次解析，结果与 lept_parse 相同，出错后可继续使用 */
+	for (k = 0; k < 2; k++)
+		for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+			lept_value_init(&h);
+			ret = lept_parse(&h, cases[i]);
+			EXPECT_EQ_INT(ret, lept_parser_parse(p, &v, cases[i]));
+			if (ret == LEPT_PARSE_OK)
+				EXPECT_TRUE(lept_is_equal(&v, &h));
+			else
+				EXPECT_EQ_INT(LEPT_NULL, lept_get_type(&v));
+			lept_free(&v);
+			lept_free(&h);
+		}
+
+	/* 长度限定 */
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_parser_parse_n(p, &v, "[1,2]xx", 5));
+	EXPECT_EQ_SIZE_T(2, lept_get_array_size(&v));
+	lept_free(&v);
+	EXPECT_EQ_INT(LEPT_PARSE_EXPECT_VALUE, lept_parser_parse_n(p, &v, NULL, 0));
+
+	lept_parser_free(p);
+}
+
+/* 事件式解析：以文本记录事件序列，第 stop 个事件要求终止 */
+typedef struct {
+	char buf[256];
+	size_t len;
+	int events, stop;
+} test_sax_trace;
+
+static int test_sax_put(void* user, const char* s, size_t len) {
+	test_sax_trace* t = (test_sax_trace*)user;
+	if (t->len + len < sizeof(t->buf)) {
+		memcpy(t->buf + t->len, s, len);
+		t->buf[t->len += len] = '\0';
+	}
+	return ++t->events == t->stop;
+}
+
+static int test_sax_null(void* user) { return test_sax_put(user, "z", 1); }
+
+static int test_sax_bool(void* user, int b) {
+	return test_sax_put(user, b ? "t" : "f", 1);
+}
+
+static int test_sax_number(void* user, double n) {
+	char buf[32];
+	sprintf(buf, "n%g", n);
+	return test_sax_put(user, buf, strlen(buf));
+}
+
+static int test_sax_string(void* user, const char* s, size_t len) {
+	test_sax_put(user, "s(", 2);
+	test_sax_put(user, s, len);
+	((test_sax_trace*)user)->events -= 2;
+	return test_sax_put(user, ")", 1);
+}
+
+static int test_sax_key(void* user, const char* k, size_t klen) {
+	test_sax_put(user, "k(", 2);
+	test_sax_put(user, k, klen);
+	((test_sax_trace*)user)->events -= 2;
+	return test_sax_put(user, ")", 1);
+}
+
+static int test_sax_start_object(void* user) {
+	return test_sax_put(user, "{", 1);
+}
+
+static int test_sax_end_object(void* user, size_t size) {
+	char buf[32];
+	sprintf(buf, "}%lu", (unsigned long)size);
+	return test_sax_put(user, buf, strlen(buf));
+}
+
+static int test_sax_start_array(void* user) {
+	return test_sax_put(user, "[", 1);
+}
+
+static int test_sax_end_array(void* user, size_t size) {
+	char buf[32];
+	sprintf(buf, "]%lu", (unsigned long)size);
+	return test_sax_put(user, buf, strlen(buf));
+}
+
+#define TEST_SAX(expect_ret, expect_trace, json, stop_at)             \
+	do {                                                              \
+		test_sax_trace t;                                             \
+		t.len = 0;                                                    \
+		t.buf[0] = '\0';                                              \
+		t.events = 0;                                                 \
+		t.stop = stop_at;                                             \
+		EXPECT_EQ_INT(expect_ret, lept_parse_sax(json, &handler, &t)); \
+		EXPECT_EQ_STRING(expect_trace, t.buf, t.len);                 \
+	} while (0)
+
+static void test_parse_sax() {
+	static const lept_handler handler = {
+	    test_sax_null,         test_sax_bool,       test_sax_number,
+	    test_sax_string,       test_sax_key,        test_sax_start_object,
+	    test_sax_end_object,   test_sax_start_array, test_sax_end_array};
+	static const lept_handler empty = {NULL, NULL, NULL, NULL, NULL,
+	                                   NULL, NULL, NULL, NULL};
+
+	TEST_SAX(LEPT_PARSE_OK, "z", " null ", 0);
+	TEST_SAX(LEPT_PARSE_OK, "n-1.5", "-1.5", 0);
+	TEST_SAX(LEPT_PARSE_OK, "s(a\nb)", "\"a\\nb\"", 0);
+	TEST_SAX(LEPT_PARSE_OK, "[]0", "[ ]", 0);
+	TEST_SAX(LEPT_PARSE_OK, "{}0", "{ }", 0);
+	TEST_SAX(LEPT_PARSE_OK, "{k(a)[n1tfz]4k(b){k(c)s(d)}1}2",
+	         "{ \"a\" : [ 1, true, false, null ], \"b\" : { \"c\" : \"d\" } }",
+	         0);
+
+	/* 出错前的事件已发出 */
+	TEST_SAX(LEPT_PARSE_MISS_COMMA_OR_SQUARE_BRACKET, "[n1", "[1 2]", 0);
+	TEST_SAX(LEPT_PARSE_MISS_COLON, "{k(a)", "{\"a\" 1}", 0);
+	TEST_SAX(LEPT_PARSE_ROOT_NOT_SINGULAR, "z", "null x", 0);
+	TEST_SAX(LEPT_PARSE_INVALID_STRING_ESCAPE, "[", "[\"\\v\"]", 0);
+
+	/* 处理函数返回非 0 时立即终止 */
+	TEST_SAX(LEPT_PARSE_STOPPED, "{", "{\"a\":[1]}", 1);
+	TEST_SAX(LEPT_PARSE_STOPPED, "{k(a)", "{\"a\":[1]}", 2);
+	TEST_SAX(LEPT_PARSE_STOPPED, "{k(a)[n1]1", "{\"a\":[1]}", 5);
+	TEST_SAX(LEPT_PARSE_STOPPED, "{k(a)[n1]1}1", "{\"a\":[1]}", 6);
+
+	/* 未设置的处理函数忽略对应事件 */
+	EXPECT_EQ_INT(LEPT_PARSE_OK,
+	              lept_parse_sax("{\"a\":[1,\"b\",null]}", &empty, NULL));
+	EXPECT_EQ_INT(LEPT_PARSE_MISS_KEY,
+	              lept_parse_sax("{\"a\":[1,\"b\",null],1}", &empty, NULL));
+}
+
 static void test_access_null() {
 	lept_value v;
 	lept_value_init(&v);
@@ -649,6 +1906,83 @@ static void test_access_string() {
 	lept_free(&v);
 }
 
+/* 短字符串存于值内，长度跨过值内容量时行为不变 */
+#if defined(LEPT_COMPACT) && defined(LEPT_LEN_MAX)
+/* 超过长度上限的设置与扩容失败而不截断，不依赖 assert */
+static void test_access_too_long() {
+	const size_t n = LEPT_LEN_MAX;
+	char* s = (char*)malloc(n + 2);
+	lept_value v;
+	size_t i;
+
+	memset(s, 'a', n + 1);
+	s[n + 1] = '\0';
+	lept_value_init(&v);
+	lept_set_number(&v, 1.0);
+	EXPECT_EQ_INT(LEPT_PARSE_TOO_LONG, lept_set_string(&v, s, n + 1));
+	EXPECT_EQ_INT(LEPT_PARSE_TOO_LONG, lept_set_string_adopt(&v, s, n + 1));
+	EXPECT_EQ_INT(LEPT_PARSE_TOO_LONG, lept_set_array(&v, n + 1));
+	EXPECT_EQ_INT(LEPT_PARSE_TOO_LONG, lept_set_object(&v, n + 1));
+	EXPECT_EQ_DOUBLE(1.0, lept_get_number(&v));
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_set_string(&v, s, n));
+	EXPECT_EQ_SIZE_T(n, lept_get_string_length(&v));
+	/* 失败时 s 仍归调用者所有 */
+	s[n] = '\0';
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_set_string_adopt(&v, s, n));
+	EXPECT_EQ_SIZE_T(n, lept_get_string_length(&v));
+
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_set_array(&v, 0));
+	EXPECT_EQ_INT(LEPT_PARSE_TOO_LONG, lept_reserve_array(&v, n + 1));
+	EXPECT_EQ_SIZE_T(0, lept_get_array_capacity(&v));
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_set_object(&v, 0));
+	EXPECT_EQ_INT(LEPT_PARSE_TOO_LONG, lept_reserve_object(&v, n + 1));
+	EXPECT_EQ_SIZE_T(0, lept_get_object_capacity(&v));
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_reserve_object(&v, n));
+	EXPECT_EQ_SIZE_T(n, lept_get_object_capacity(&v));
+
+	/* 容量倍增不越过上限 */
+	EXPECT_EQ_INT(LEPT_PARSE_OK, lept_set_array(&v, n - 1));
+	for (i = 0; i < n; i++)
+		lept_emplace_back_array_element(&v);
+	EXPECT_EQ_SIZE_T(n, lept_get_array_size(&v));
+	EXPECT_EQ_SIZE_T(n, lept_get_array_capacity(&v));
+	lept_free(&v);
+}
+#endif
+
+static void test_access_short_string() {
+	static const char s[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+	char json[64];
+	size_t len;
+	lept_value v, w, h;
+	lept_value_init(&v);
+	lept_value_init(&w);
+	lept_value_init(&h);
+	for (len = 0; len < sizeof(s); len++) {
+		const char* p;
+		lept_set_string(&v, s, len);
+		p = lept_get_string(&v);
+		EXPECT_EQ_SIZE_T(len, lept_get_string_length(&v));
+		EXPECT_TRUE(memcmp(p, s, len) == 0 && p[len] == '\0');
+		lept_copy(&w, &v);
+		EXPECT_TRUE(lept_is_equal(&v, &w));
+
+		sprintf(json, "[\"%.*s\"]", (int)len, s);
+		EXPECT_EQ_INT(LEPT_PARSE_OK, lept_parse(&h, json));
+		EXPECT_TRUE(lept_is_equal(lept_get_array_element(&h, 0), &v));
+		lept_free(&h);
+	}
+	/* 值内存储随值移动 */
+	lept_set_string(&v, "abc", 3);
+	EXPECT_TRUE(lept_get_string(&v) >= (const char*)&v &&
+	            lept_get_string(&v) < (const char*)(&v + 1));
+	lept_move(&w, &v);
+	EXPECT_EQ_STRING("abc", lept_get_string(&w), lept_get_string_length(&w));
+	lept_set_string(&w, lept_get_string(&w) + 1, 2);
+	EXPECT_EQ_STRING("bc", lept_get_string(&w), lept_get_string_length(&w));
+	lept_free(&w);
+}
+
 static void test_access_array() {
 	lept_value a, e;
 	size_t i, j;
@@ -724,18 +2058,110 @@ static void test_access_array() {
 	lept_pushback_array_element(&a, &e);
 	lept_free(&e);
 
-	/* 此处在 earse 时修改了其容量变化规则，故在清空时容量值会变为 1 */
-	/* i = lept_get_array_capacity(&a); */
+	/* 插入自身的元素 */
+	lept_set_array(&a, 8);
+	for (i = 1; i <= 3; i++)
+		lept_set_number(lept_emplace_back_array_element(&a), (double)i);
+	lept_insert_array_element(&a, lept_get_array_element(&a, 1), 0);
+	lept_insert_array_element(&a, lept_get_array_element(&a, 2), 2);
+	lept_pushback_array_element(&a, lept_get_array_element(&a, 0));
+	lept_shrink_array(&a);
+	lept_pushback_array_element(&a, lept_get_array_element(&a, 1));
+	EXPECT_EQ_SIZE_T(7, lept_get_array_size(&a));
+	for (i = 0; i < 7; i++) {
+		static const double expect[] = {2, 1, 2, 2, 3, 2, 1};
+		EXPECT_EQ_DOUBLE(expect[i],
+		                 lept_get_number(lept_get_array_element(&a, i)));
+	}
+
+	i = lept_get_array_capacity(&a);
 	lept_clear_array(&a);
 	EXPECT_EQ_SIZE_T(0, lept_get_array_size(&a));
 	EXPECT_EQ_SIZE_T(
-	    1, lept_get_array_capacity(&a)); /* capacity remains unchanged */
+	    i, lept_get_array_capacity(&a)); /* capacity remains unchanged */
 	lept_shrink_array(&a);
 	EXPECT_EQ_SIZE_T(0, lept_get_array_capacity(&a));
 
 	lept_free(&a);
 }
 
+static void test_access_array_range() {
+	lept_value a, e[4];
+	size_t i;
+
+	lept_value_init(&a);
+	lept_set_array(&a, 0);
+	for (i = 0; i < 4; i++) {
+		lept_value_init(&e[i]);
+		lept_set_number(&e[i], (double)i);
+	}
+	lept_append_array_range(&a, e, 4);
+	lept_append_array_range(&a, e, 4);
+	lept_insert_array_range(&a, e, 2, 4);
+	EXPECT_EQ_SIZE_T(10, lept_get_array_size(&a));
+	for (i = 0; i < 10; i++)
+		EXPECT_EQ_DOUBLE((double)(i < 4 ? i : i < 6 ? i - 4 : i - 6),
+		                 lept_get_number(lept_get_array_element(&a, i)));
+
+	lept_set_string(&e[1], "a long string that is not inline", 32);
+	lept_insert_array_range_move(&a, e, 4, 0);
+	for (i = 0; i < 4; i++)
+		EXPECT_EQ_INT(LEPT_NULL, lept_get_type(&e[i]));
+	EXPECT_EQ_SIZE_T(14, lept_get_array_size(&a));
+	EXPECT_EQ_INT(LEPT_STRING, lept_get_type(lept_get_array_element(&a, 1)));
+
+	lept_erase_array_element(&a, 0, 4);
+	EXPECT_EQ_SIZE_T(10, lept_get_array_size(&a));
+	EXPECT_EQ_DOUBLE(0.0, lept_get_number(lept_get_array_element(&a, 4)));
+	EXPECT_EQ_DOUBLE(3.0, lept_get_number(lept_get_array_element(&a, 9)));
+
+	/* 区间来自数组自身，包括跨越插入位置的区间 */
+	lept_clear_array(&a);
+	lept_shrink_array(&a);
+	lept_insert_array_range(&a, NULL, 0, 0);
+	lept_insert_array_range_move(&a, NULL, 0, 0);
+	lept_erase_array_element(&a, 0, 0);
+	for (i = 1; i <= 3; i++)
+		lept_set_number(lept_emplace_back_array_element(&a), (double)i);
+	lept_shrink_array(&a);
+	lept_append_array_range(&a, lept_get_array_element(&a, 0), 3);
+	lept_insert_array_range(&a, lept_get_array_element(&a, 1), 3, 2);
+	EXPECT_EQ_SIZE_T(9, lept_get_array_size(&a));
+	for (i = 0; i < 9; i++) {
+		static const double expect[] = {1, 2, 2, 3, 1, 3, 1, 2, 3};
+		EXPECT_EQ_DOUBLE(expect[i],
+		                 lept_get_number(lept_get_array_element(&a, i)));
+	}
+	lept_insert_array_range_move(&a, (lept_value*)lept_get_array_element(&a, 7),
+	                             2, 0);
+	EXPECT_EQ_SIZE_T(11, lept_get_array_size(&a));
+	EXPECT_EQ_DOUBLE(2.0, lept_get_number(lept_get_array_element(&a, 0)));
+	EXPECT_EQ_DOUBLE(3.0, lept_get_number(lept_get_array_element(&a, 1)));
+	EXPECT_EQ_INT(LEPT_NULL, lept_get_type(lept_get_array_element(&a, 9)));
+	EXPECT_EQ_INT(LEPT_NULL, lept_get_type(lept_get_array_element(&a, 10)));
+
+	/* 容量边界附近交替增删，容量不应变化 */
+	lept_clear_array(&a);
+	lept_shrink_array(&a);
+	for (i = 0; i < 16; i++)
+		lept_pushback_array_element(&a, &e[0]);
+	EXPECT_EQ_SIZE_T(16, lept_get_array_capacity(&a));
+	for (i = 0; i < 100; i++) {
+		lept_pushback_array_element(&a, &e[0]);
+		lept_erase_array_element(&a, lept_get_array_size(&a) - 1, 1);
+		lept_erase_array_element(&a, lept_get_array_size(&a) - 1, 1);
+		lept_pushback_array_element(&a, &e[0]);
+	}
+	EXPECT_EQ_SIZE_T(32, lept_get_array_capacity(&a));
+
+	/* 降至容量的 1/4 时收缩 */
+	lept_erase_array_element(&a, 0, 8);
+	EXPECT_EQ_SIZE_T(16, lept_get_array_capacity(&a));
+	EXPECT_EQ_SIZE_T(8, lept_get_array_size(&a));
+
+	lept_free(&a);
+}
+
 static void test_access_object() {
 
 	lept_value o, v;
@@ -806,11 +2232,11 @@ static void test_access_object() {
 	EXPECT_TRUE(pv != NULL);
 	EXPECT_EQ_STRING("Hello", lept_get_string(pv), lept_get_string_length(pv));
 
-	lept_get_object_capacity(&o);
+	i = lept_get_object_capacity(&o);
 	lept_clear_object(&o);
 	EXPECT_EQ_SIZE_T(0, lept_get_object_size(&o));
-	/* 删除值时会调整 capacity ，清空时其大小应为 0 * 2 + 1 = 1 */
-	EXPECT_EQ_SIZE_T(1, lept_get_object_capacity(&o));
+	EXPECT_EQ_SIZE_T(i, lept_get_object_capacity(&o));
+	EXPECT_TRUE(lept_find_object_value(&o, "World", 5) == NULL);
 	lept_shrink_object(&o);
 	EXPECT_EQ_SIZE_T(0, lept_get_object_capacity(&o));
 
@@ -821,23 +2247,105 @@ static void test_access_object() {
 /* 总的测试函数 */
 /***************/
 
+/* 大对象的散列索引在插入、删除、清空后与成员保持一致 */
+static void test_access_object_index() {
+	lept_value o, v, h;
+	char key[16];
+	size_t i, n = 1000, ok;
+
+	lept_value_init(&o);
+	lept_value_init(&v);
+	lept_set_object(&o, 0);
+	for (i = 0; i < n; i++) {
+		sprintf(key, "k%lu", (unsigned long)i);
+		lept_set_number(&v, (double)i);
+		EXPECT_EQ_INT(INSERT_OBJECT_OK,
+		              lept_set_object_value_by_key(&o, key, strlen(key), &v));
+	}
+
+	/* 依次删除头部、中部、尾部的成员，其余成员下标随之前移 */
+	for (i = 0; i < n; i += 3) {
+		sprintf(key, "k%lu", (unsigned long)i);
+		EXPECT_EQ_INT(REMOVE_OBJECT_OK,
+		              lept_remove_object_value_by_key(&o, key, strlen(key)));
+	}
+	EXPECT_EQ_SIZE_T(n - (n + 2) / 3, lept_get_object_size(&o));
+	ok = 1;
+	for (i = 0; i < n; i++) {
+		const lept_value* e;
+		sprintf(key, "k%lu", (unsigned long)i);
+		e = lept_find_object_value(&o, key, strlen(key));
+		if (i % 3 == 0 ? e != NULL : e == NULL || lept_get_number(e) != i)
+			ok = 0;
+	}
+	EXPECT_TRUE(ok);
+
+	/* 成员顺序保持插入顺序 */
+	EXPECT_EQ_STRING("k1", lept_get_object_key(&o, 0),
+	                 lept_get_object_key_length(&o, 0));
+	EXPECT_EQ_STRING("k2", lept_get_object_key(&o, 1),
+	                 lept_get_object_key_length(&o, 1));
+
+	lept_clear_object(&o);
+	EXPECT_EQ_SIZE_T(0, lept_get_object_size(&o));
+	EXPECT_TRUE(lept_find_object_value(&o, "k1", 2) == NULL);
+	lept_set_object_value_by_key(&o, "k1", 2, &v);
+	EXPECT_EQ_SIZE_T(0, lept_find_object_index(&o, "k1", 2));
+	lept_free(&o);
+
+	/* 解析得到的大对象同样建立索引，重复的键返回首个 */
+	EXPECT_EQ_INT(LEPT_PARSE_OK,
+	              lept_parse(&o, "{\"a\":0,\"b\":1,\"c\":2,\"d\":3,\"e\":4,"
+	                             "\"f\":5,\"g\":6,\"h\":7,\"i\":8,\"j\":9,"
+	                             "\"k\":10,\"l\":11,\"m\":12,\"n\":13,\"o\":14,"
+	                             "\"p\":15,\"a\":16}"));
+	EXPECT_EQ_SIZE_T(0, lept_find_object_index(&o, "a", 1));
+	EXPECT_EQ_SIZE_T(15, lept_find_object_index(&o, "p", 1));
+	EXPECT_EQ_SIZE_T(LEPT_KEY_NOT_EXIST, lept_find_object_index(&o, "q", 1));
+	lept_remove_object_value_by_index(&o, 0);
+	EXPECT_EQ_SIZE_T(15, lept_find_object_index(&o, "a", 1));
+	lept_value_init(&h);
+	lept_copy(&h, &o);
+	EXPECT_TRUE(lept_is_equal(&h, &o));
+	lept_free(&h);
+	lept_free(&o);
+	lept_free(&v);
+}
+
 static void test() {
 
 	test_parse();
 	test_stringify();
 
 	test_equal();
+	test_hash();
 	test_copy();
+	test_copy_large();
 	test_move();
+	test_move_in();
 	test_swap();
+	test_arena();
+	test_allocator();
+	test_insitu();
+	test_lazy();
+	test_keypool();
+	test_push_parser();
+	test_parser();
+	test_parse_sax();
 
 	/* 其余接口测试 */
 	test_access_null();
 	test_access_boolean();
 	test_access_number();
 	test_access_string();
+	test_access_short_string();
+#if defined(LEPT_COMPACT) && defined(LEPT_LEN_MAX)
+	test_access_too_long();
+#endif
 	test_access_array();
+	test_access_array_range();
 	test_access_object();
+	test_access_object_index();
 }
 
 int main() {